@@ -30,6 +30,8 @@ void (Coords::Cartesian::*setX)(const double&) = &Coords::Cartesian::x;
 void (Coords::Cartesian::*setY)(const double&) = &Coords::Cartesian::y;
 void (Coords::Cartesian::*setZ)(const double&) = &Coords::Cartesian::z;
 
+Coords::Cartesian (Coords::rotator::*rotate)(const Coords::Cartesian&, const Coords::angle&) = &Coords::rotator::rotate;
+
 void (Coords::spherical::*setR)(const double&) = &Coords::spherical::r;
 void (Coords::spherical::*setTheta)(const Coords::angle&) = &Coords::spherical::theta;
 void (Coords::spherical::*setPhi)(const Coords::angle&) = &Coords::spherical::phi;
@@ -216,7 +218,7 @@ BOOST_PYTHON_MODULE(coords) {
 
     // other methods
 
-    .def("rotate", &Coords::rotator::rotate)
+    .def("rotate", rotate)
 
     ; // end of rotator class_
 
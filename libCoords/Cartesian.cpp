@@ -21,6 +21,12 @@
 //  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
 // ==================================================================
 
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+
 #include <angle.h>
 #include <Cartesian.h>
 #include <spherical.h>
@@ -62,253 +68,208 @@ Coords::Cartesian::Cartesian(const Coords::spherical& a)
   x(r_xy * cos(a.phi().radians()));
 }
 
-// ----- copy constructor -----
-Coords::Cartesian::Cartesian(const Coords::Cartesian& a) {
-  x(a.x());
-  y(a.y());
-  z(a.z());
-};
+// ----- trivially copyable -----
 
-// ----- copy assignment -----
-Coords::Cartesian& Coords::Cartesian::operator=(const Coords::Cartesian& rhs) {
-  if (this == &rhs) return *this;
-  x(rhs.x());
-  y(rhs.y());
-  z(rhs.z());
-  return *this;
-}
+static_assert(std::is_trivially_copyable<Coords::Cartesian>::value,
+	      "Cartesian must stay trivially copyable for CartesianArray and memcpy");
 
-// ----- bool operators -----
+static_assert(sizeof(Coords::Cartesian) == 3*sizeof(double),
+	      "Cartesian must be three packed doubles");
 
-bool Coords::Cartesian::operator== (const Coords::Cartesian& rhs) const {
-  return x() == rhs.x() && y() == rhs.y() && z() == rhs.z();
-}
+// --------------------------
+// ----- class rotation -----
+// --------------------------
 
-bool Coords::Cartesian::operator!= (const Coords::Cartesian& rhs) const {
-  return !operator==(rhs);
+Coords::rotation::rotation() : m_matrix() {
+  m_matrix[0][0] = 1;
+  m_matrix[1][1] = 1;
+  m_matrix[2][2] = 1;
 }
 
-// ----- in-place operators -----
-
-Coords::Cartesian& Coords::Cartesian::operator+=(const Coords::Cartesian& rhs) {
-  m_x += rhs.x();
-  m_y += rhs.y();
-  m_z += rhs.z();
-  return *this;
+Coords::rotation::rotation(const Coords::Cartesian& an_axis, const Coords::angle& an_angle) {
+  build(an_axis.normalized(), cos(an_angle.radians()), sin(an_angle.radians()));
 }
 
-Coords::Cartesian& Coords::Cartesian::operator-=(const Coords::Cartesian& rhs) {
-  m_x -= rhs.x();
-  m_y -= rhs.y();
-  m_z -= rhs.z();
-  return *this;
+Coords::rotation::rotation(const Coords::Cartesian& an_axis, const Coords::cachedAngle& an_angle) {
+  build(an_axis.normalized(), an_angle.cos(), an_angle.sin());
 }
 
-Coords::Cartesian& Coords::Cartesian::operator*=(const double& rhs) {
-  m_x *= rhs;
-  m_y *= rhs;
-  m_z *= rhs;
-  return *this;
+Coords::rotation::rotation(const Coords::Cartesian& an_axis, const double& a_cos, const double& a_sin) {
+  build(an_axis.normalized(), a_cos, a_sin);
 }
 
-Coords::Cartesian& Coords::Cartesian::operator/=(const double& rhs) {
-  if (rhs == 0)
-    throw DivideByZeroError();
-  m_x /= rhs;
-  m_y /= rhs;
-  m_z /= rhs;
-  return *this;
-}
+void Coords::rotation::build(const Coords::Cartesian& axis, const double& c, const double& s) {
 
-// ----- normalizing -----
+  // Quaternion-derived rotation matrix
+  // http://en.wikipedia.org/wiki/Quaternions_and_spatial_rotation#Quaternion-derived_rotation_matrix
+  // http://en.wikipedia.org/wiki/Rotation_matrix#Rotation_matrix_from_axis_and_angle
 
-double Coords::Cartesian::magnitude() const {
-  return sqrt(magnitude2());
-}
+  // TODO this is ok for rotations about Ux, Uy, Uz, but not right in
+  // the diagonal (1,1,1) and others? See DISABLED_RotationTest, Diagonal_xyz_180.
 
-double Coords::Cartesian::magnitude2() const {
-  return m_x*m_x + m_y*m_y + m_z*m_z;
-}
+  double t(1-c);
 
-Coords::Cartesian Coords::Cartesian::normalized() const {
-  const double h(magnitude());
-  return Coords::Cartesian(m_x/h, m_y/h, m_z/h);
-}
+  m_matrix[0][0] = c + axis.x()*axis.x()*t;
+  m_matrix[1][1] = c + axis.y()*axis.y()*t;
+  m_matrix[2][2] = c + axis.z()*axis.z()*t;
 
-// ---------------------
-// ----- operators -----
-// ---------------------
+  double t1(axis.x()*axis.y()*t);
+  double t2(axis.z()*s);
 
-Coords::Cartesian Coords::operator+(const Coords::Cartesian& lhs,
-				    const Coords::Cartesian& rhs) {
-  return Coords::Cartesian(lhs.x() + rhs.x(),
-			   lhs.y() + rhs.y(),
-			   lhs.z() + rhs.z());
-}
+  m_matrix[1][0] = t1 + t2;
+  m_matrix[0][1] = t1 - t2;
 
-Coords::Cartesian Coords::operator-(const Coords::Cartesian& lhs,
-				    const Coords::Cartesian& rhs) {
-  return Coords::Cartesian(lhs.x() - rhs.x(),
-			   lhs.y() - rhs.y(),
-			   lhs.z() - rhs.z());
-}
+  t1 = axis.x()*axis.z()*t;
+  t2 = axis.y()*s;
 
-Coords::Cartesian Coords::operator-(const Coords::Cartesian& rhs) {
-  return Coords::Cartesian(-rhs.x(),
-			   -rhs.y(),
-			   -rhs.z());
-}
+  m_matrix[2][0] = t1 - t2;
+  m_matrix[0][2] = t1 + t2;
 
-// scale
-Coords::Cartesian Coords::operator*(const Coords::Cartesian& lhs,
-				    const double& rhs) {
-  return Coords::Cartesian(lhs.x() * rhs, lhs.y() * rhs, lhs.z() * rhs);
-}
-
-Coords::Cartesian Coords::operator*(const double& lhs,
-				    const Coords::Cartesian& rhs) {
-  return Coords::operator*(rhs, lhs);
-}
+  t1 = axis.y()*axis.z()*t;
+  t2 = axis.x()*s;
 
-Coords::Cartesian Coords::operator/(const Coords::Cartesian& lhs,
-				    const double& rhs) {
-  if (rhs == 0)
-    throw DivideByZeroError();
-  return Coords::Cartesian(lhs.x() / rhs, lhs.y() / rhs, lhs.z() / rhs);
-}
+  m_matrix[2][1] = t1 + t2;
+  m_matrix[1][2] = t1 - t2;
 
-Coords::Cartesian Coords::operator/(const double& lhs,
-				    const Coords::Cartesian& rhs) {
-  if (rhs.x() == 0 || rhs.y() == 0 || rhs.z() == 0)
-    throw DivideByZeroError();
-  return Coords::Cartesian(lhs / rhs.x(), lhs / rhs.y(), lhs / rhs.z());
 }
 
-// ----- vector products -----
-
-double Coords::operator*(const Coords::Cartesian& lhs,
-			 const Coords::Cartesian& rhs) {
-  return lhs.x()*rhs.x() + lhs.y()*rhs.y() + lhs.z()*rhs.z();
+Coords::rotation Coords::rotation::inverse() const {
+  Coords::rotation transpose;
+  for (unsigned int i = 0; i < 3; ++i)
+    for (unsigned int j = 0; j < 3; ++j)
+      transpose.m_matrix[i][j] = m_matrix[j][i];
+  return transpose;
 }
 
-double Coords::dot(const Coords::Cartesian& lhs,
-		   const Coords::Cartesian& rhs) {
-  return lhs * rhs;
+Coords::rotation Coords::operator*(const Coords::rotation& lhs, const Coords::rotation& rhs) {
+  Coords::rotation product;
+  for (unsigned int i = 0; i < 3; ++i)
+    for (unsigned int j = 0; j < 3; ++j)
+      product.m_matrix[i][j] =
+	lhs.m_matrix[i][0]*rhs.m_matrix[0][j] +
+	lhs.m_matrix[i][1]*rhs.m_matrix[1][j] +
+	lhs.m_matrix[i][2]*rhs.m_matrix[2][j];
+  return product;
 }
 
-Coords::Cartesian Coords::cross(const Coords::Cartesian& a,
-				const Coords::Cartesian& b) {
-  Coords::Cartesian tmp;
-  tmp.x(a.y()*b.z() - a.z()*b.y());
-  tmp.y(a.z()*b.x() - a.x()*b.z());
-  tmp.z(a.x()*b.y() - a.y()*b.x());
-  return tmp;
-}
+static_assert(std::is_trivially_copyable<Coords::rotation>::value,
+	      "rotation must stay trivially copyable for the rotator cache");
 
 // -------------------------
 // ----- class rotator -----
 // -------------------------
 
+const unsigned int Coords::rotator::cache_size;
+
 Coords::rotator::rotator(const Coords::Cartesian& an_axis) :
   m_axis(Coords::Cartesian::Uo),
-  m_rotation_matrix(3, std::vector<double>(3, 0)),
-  m_is_new_axis(true),
-  m_current_angle(0.0) {
+  m_cache(),
+  m_current(0),
+  m_clock(0),
+  m_cache_hits(0),
+  m_cache_misses(0) {
   axis(an_axis);
 }
 
 // copy constructor
 Coords::rotator::rotator(const Coords::rotator& a) :
-  m_axis(Coords::Cartesian::Uo),
-  m_is_new_axis(true),
-  m_current_angle(0.0) {
-  m_rotation_matrix.clear();
-  m_rotation_matrix = a.m_rotation_matrix;
-  axis(a.axis());
+  m_axis(a.m_axis),
+  m_current(a.m_current),
+  m_clock(a.m_clock),
+  m_cache_hits(a.m_cache_hits),
+  m_cache_misses(a.m_cache_misses) {
+  std::copy(a.m_cache, a.m_cache + cache_size, m_cache);
 }
 
 // copy assign
 Coords::rotator& Coords::rotator::operator=(const Coords::rotator& rhs) {
   if (this == &rhs) return *this;
-  m_rotation_matrix.clear();
-  m_rotation_matrix = rhs.m_rotation_matrix;
-  axis(rhs.axis());
+  m_axis = rhs.m_axis;
+  std::copy(rhs.m_cache, rhs.m_cache + cache_size, m_cache);
+  m_current = rhs.m_current;
+  m_clock = rhs.m_clock;
+  m_cache_hits = rhs.m_cache_hits;
+  m_cache_misses = rhs.m_cache_misses;
   return *this;
 }
 
 // axis access
 void Coords::rotator::axis(const Coords::Cartesian& an_axis) {
-  if (an_axis != m_axis) {
+  if (an_axis != m_axis)
     m_axis = an_axis.normalized();
-    m_is_new_axis = true;
-  }
 }
 
-Coords::Cartesian Coords::rotator::rotate(const Coords::Cartesian& a_vector,
-					  const Coords::angle& an_angle) {
+bool Coords::rotator::lookup(const double& a_degrees, unsigned int& an_index) {
 
-  // Quaternion-derived rotation matrix
-  // http://en.wikipedia.org/wiki/Quaternions_and_spatial_rotation#Quaternion-derived_rotation_matrix
-  // http://en.wikipedia.org/wiki/Rotation_matrix#Rotation_matrix_from_axis_and_angle
+  ++m_clock;
 
-  // TODO this is ok for rotations about Ux, Uy, Uz, but not right in
-  // the diagonal (1,1,1) and others? See DISABLED_RotationTest, Diagonal_xyz_180.
+  // last used first, then the rest, remembering the oldest to replace.
 
-  // Python Manual is not picking up this initialization like Boost
-  if (m_rotation_matrix.size() != 3) {
-    m_rotation_matrix.clear();
-    for(int i = 0; i < 3; ++i) {
-      std::vector<double> row(3, 0);
-      m_rotation_matrix.push_back(row);
-    }
+  if (m_cache[m_current].last_used != 0 &&
+      m_cache[m_current].degrees == a_degrees &&
+      m_cache[m_current].axis == m_axis) {
+    ++m_cache_hits;
+    m_cache[m_current].last_used = m_clock;
+    an_index = m_current;
+    return true;
   }
 
-  if (m_is_new_axis || m_current_angle != an_angle) {
+  unsigned int oldest(0);
 
-    double c(cos(an_angle.radians()));
-    double s(sin(an_angle.radians()));
+  for (unsigned int i = 0; i < cache_size; ++i) {
 
-    double t(1-c);
+    if (m_cache[i].last_used != 0 &&
+	m_cache[i].degrees == a_degrees &&
+	m_cache[i].axis == m_axis) {
+      ++m_cache_hits;
+      m_cache[i].last_used = m_clock;
+      m_current = i;
+      an_index = i;
+      return true;
+    }
 
-    m_rotation_matrix[0][0] = c + axis().x()*axis().x()*t;
-    m_rotation_matrix[1][1] = c + axis().y()*axis().y()*t;
-    m_rotation_matrix[2][2] = c + axis().z()*axis().z()*t;
+    if (m_cache[i].last_used < m_cache[oldest].last_used)
+      oldest = i;
 
-    double t1(axis().x()*axis().y()*t);
-    double t2(axis().z()*s);
+  }
 
-    m_rotation_matrix[1][0] = t1 + t2;
-    m_rotation_matrix[0][1] = t1 - t2;
+  ++m_cache_misses;
 
-    t1 = axis().x()*axis().z()*t;
-    t2 = axis().y()*s;
+  cachedMatrix& entry(m_cache[oldest]);
 
-    m_rotation_matrix[2][0] = t1 - t2;
-    m_rotation_matrix[0][2] = t1 + t2;
+  entry.axis = m_axis;
+  entry.degrees = a_degrees;
+  entry.last_used = m_clock;
 
-    t1 = axis().y()*axis().z()*t;
-    t2 = axis().x()*s;
+  m_current = oldest;
+  an_index = oldest;
 
-    m_rotation_matrix[2][1] = t1 + t2;
-    m_rotation_matrix[1][2] = t1 - t2;
+  return false;
 
-    m_is_new_axis = false;
-    m_current_angle = an_angle;
+}
 
-  }
+const Coords::rotation& Coords::rotator::matrix(const Coords::angle& an_angle) {
+  unsigned int idx;
+  if (!lookup(an_angle.degrees(), idx))
+    m_cache[idx].matrix = Coords::rotation(m_axis, an_angle);
+  return m_cache[idx].matrix;
+}
 
-  Coords::Cartesian tmp(m_rotation_matrix[0][0]*a_vector.x() +
-			m_rotation_matrix[0][1]*a_vector.y() +
-			m_rotation_matrix[0][2]*a_vector.z(),
-			m_rotation_matrix[1][0]*a_vector.x() +
-			m_rotation_matrix[1][1]*a_vector.y() +
-			m_rotation_matrix[1][2]*a_vector.z(),
-			m_rotation_matrix[2][0]*a_vector.x() +
-			m_rotation_matrix[2][1]*a_vector.y() +
-			m_rotation_matrix[2][2]*a_vector.z());
+const Coords::rotation& Coords::rotator::matrix(const Coords::cachedAngle& an_angle) {
+  unsigned int idx;
+  if (!lookup(an_angle.degrees(), idx))
+    m_cache[idx].matrix = Coords::rotation(m_axis, an_angle);
+  return m_cache[idx].matrix;
+}
 
-  return tmp;
+Coords::Cartesian Coords::rotator::rotate(const Coords::Cartesian& a_vector,
+					  const Coords::angle& an_angle) {
+  return matrix(an_angle).apply(a_vector);
+}
 
+Coords::Cartesian Coords::rotator::rotate(const Coords::Cartesian& a_vector,
+					  const Coords::cachedAngle& an_angle) {
+  return matrix(an_angle).apply(a_vector);
 }
 
 
@@ -320,56 +281,175 @@ const unsigned int Coords::CartesianRecorder::default_size(1024);
 
 Coords::CartesianRecorder::CartesianRecorder(const unsigned int& a_size_limit) :
   m_size_limit(a_size_limit),
-  m_data(std::deque<Coords::Cartesian>(m_size_limit))
+  m_data(a_size_limit),
+  m_head(0),
+  m_tail(0),
+  m_size(0)
 {}
 
 Coords::CartesianRecorder::CartesianRecorder(const Coords::CartesianRecorder& a):
-  m_size_limit(a.sizeLimit()),
-  m_data(a.m_data)
+  m_size_limit(a.m_size_limit),
+  m_data(a.m_data),
+  m_head(a.m_head),
+  m_tail(a.m_tail),
+  m_size(a.m_size)
 {}
 
 Coords::CartesianRecorder&
 Coords::CartesianRecorder::operator=(const Coords::CartesianRecorder& rhs) {
   if (this == &rhs) return *this;
-  sizeLimit(rhs.sizeLimit());
+  m_size_limit = rhs.m_size_limit;
   m_data = rhs.m_data;
+  m_head = rhs.m_head;
+  m_tail = rhs.m_tail;
+  m_size = rhs.m_size;
   return *this;
 }
 
-void Coords::CartesianRecorder::push(Coords::Cartesian a) {
-  // even up the sizes to just under the limit.
-  while (m_data.size() > sizeLimit() - 1)
-    m_data.pop_front();
-  m_data.push_back(a);
+void Coords::CartesianRecorder::sizeLimit(const int& a) {
+  // copy out the newest points oldest first
+  const unsigned int new_limit(a < 0 ? 0 : a);
+  const unsigned long keep(m_size < new_limit ? m_size : new_limit);
+
+  std::vector<Coords::Cartesian> data(new_limit);
+  for (unsigned long i = 0; i < keep; ++i)
+    data[i] = get(m_size - keep + i);
+
+  m_data.swap(data);
+  m_size_limit = new_limit;
+  m_head = 0;
+  m_size = keep;
+  m_tail = keep < new_limit ? keep : 0;
 }
 
+namespace {
+
+  // A FILE with a large buffer of its own so rows are formatted in
+  // place and written in big blocks.
+
+  class bufferedFile {
+  public:
+
+    static const unsigned long buffer_size = 1 << 20;
+    static const unsigned long max_row = 128; // longest formatted row
+
+    explicit bufferedFile(const std::string& flnm)
+      : m_flnm(flnm), m_file(fopen(flnm.c_str(), "wb")), m_buffer(buffer_size), m_used(0) {
+      if (!m_file) {
+	std::stringstream err;
+	err << "Error: unable to open file \"" << flnm << "\"";
+	throw Coords::CartesianRecorderIOError(err.str());
+      }
+    }
+
+    ~bufferedFile() {
+      if (m_file)
+	fclose(m_file);
+    }
+
+    // room for at least max_row chars
+    char* reserve() {
+      if (buffer_size - m_used < max_row)
+	flush();
+      return m_buffer.data() + m_used;
+    }
+
+    void commit(const int& n) {m_used += n;}
+
+    void write(const void* data, const unsigned long& n) {
+      if (buffer_size - m_used < n) {
+	flush();
+	if (fwrite(data, 1, n, m_file) != n)
+	  error();
+	return;
+      }
+      memcpy(m_buffer.data() + m_used, data, n);
+      m_used += n;
+    }
+
+    void flush() {
+      if (m_used != 0 && fwrite(m_buffer.data(), 1, m_used, m_file) != m_used)
+	error();
+      m_used = 0;
+    }
+
+    void close() {
+      flush();
+      FILE* file(m_file);
+      m_file = 0;
+      if (fclose(file) != 0)
+	error();
+    }
+
+  private:
+
+    void error() {
+      std::stringstream err;
+      err << "Error: unable to write file \"" << m_flnm << "\"";
+      throw Coords::CartesianRecorderIOError(err.str());
+    }
+
+    std::string       m_flnm;
+    FILE*             m_file;
+    std::vector<char> m_buffer;
+    unsigned long     m_used;
+
+  };
+
+  const unsigned long bufferedFile::buffer_size;
+  const unsigned long bufferedFile::max_row;
+
+} // end anonymous namespace
+
+const char Coords::CartesianRecorder::binary_magic[8] = {'C', 'R', 'D', 'R', 'E', 'C', '0', '1'};
+
 // output compatible for R frames <- read.table(flnm)
 void Coords::CartesianRecorder::write2R(const std::string& flnm, bool skip_Uo) {
 
-  std::ofstream ssfile(flnm.c_str());
+  bufferedFile ssfile(flnm);
 
-  if (!ssfile.is_open()) {
-    std::stringstream err;
-    err << "Error: unable to open file \"" << flnm << "\"";
-    throw Coords::CartesianRecorderIOError(err.str());
-  }
+  std::string header("# Formated for R frames <- read.table(" + flnm + ")\nx y z\n");
+  ssfile.write(header.data(), header.size());
 
-  ssfile << "# Formated for R frames <- read.table(" << flnm << ")"
-	 << std::endl;
-  ssfile << "x y z" << std::endl;
+  for (unsigned int k = 0; k < size(); ++k) {
 
-  for (unsigned int k = 0; k < m_data.size(); ++k) {
+    const Coords::Cartesian& a(get(k));
 
-    // skip zero points from partially filled buffer.
-    if (skip_Uo and m_data[k] == Coords::Cartesian::Uo)
+    if (skip_Uo and a == Coords::Cartesian::Uo)
       continue;
 
-    ssfile << k << " "
-	   << m_data[k].x() << " "
-	   << m_data[k].y() << " "
-	   << m_data[k].z() << std::endl;
+    // %g is the ostream default format, precision 6
+    ssfile.commit(snprintf(ssfile.reserve(), bufferedFile::max_row, "%u %g %g %g\n",
+			   k, a.x(), a.y(), a.z()));
   }
 
   ssfile.close();
 
 }
+
+void Coords::CartesianRecorder::write2Binary(const std::string& flnm) const {
+
+  bufferedFile binfile(flnm);
+
+  const uint64_t n(size());
+  binfile.write(binary_magic, sizeof(binary_magic));
+  binfile.write(&n, sizeof(n));
+
+  // gather each column in blocks from the two segments
+  double block[4096];
+  const unsigned long block_size(sizeof(block)/sizeof(block[0]));
+
+  for (int column = 0; column < 3; ++column) {
+    for (unsigned long k = 0; k < size(); k += block_size) {
+      const unsigned long m(std::min(block_size, size() - k));
+      for (unsigned long i = 0; i < m; ++i) {
+	const Coords::Cartesian& a(get(k + i));
+	block[i] = column == 0 ? a.x() : column == 1 ? a.y() : a.z();
+      }
+      binfile.write(block, m*sizeof(double));
+    }
+  }
+
+  binfile.close();
+
+}
@@ -26,7 +26,6 @@
 #pragma once
 
 #include <cmath>
-#include <deque>
 #include <fstream>
 #include <vector>
 
@@ -35,7 +34,9 @@
 namespace Coords {
 
   class angle;
+  class cachedAngle;
   class spherical;
+  class CartesianArray;
 
   class Cartesian {
   public:
@@ -49,9 +50,9 @@ namespace Coords {
 
     // ----- ctor and dtor -----
 
-    explicit Cartesian(const double& a = 0.0,
-		       const double& b = 0.0,
-		       const double& c = 0.0)
+    constexpr explicit Cartesian(const double& a = 0.0,
+				 const double& b = 0.0,
+				 const double& c = 0.0)
       : m_x(a), m_y(b), m_z(c) {}; // ctors, including default.
 
     explicit Cartesian(const std::string& a, // The ambiguity is in the box.
@@ -60,46 +61,74 @@ namespace Coords {
 
     explicit Cartesian(const spherical& a);
 
-    ~Cartesian() {};
-
-    Cartesian(const Cartesian& a);
-    Cartesian& operator=(const Cartesian& rhs);
+    // The compiler generated copy constructor, copy assignment and
+    // destructor keep Cartesian trivially copyable.
 
     // ----- accessors -----
 
-    void          x(const double& rhs) {m_x = rhs;}
-    const double& x() const            {return m_x;}
-    double        getX() const         {return m_x;} // for boost python wrappers
+    void                    x(const double& rhs) {m_x = rhs;}
+    constexpr const double& x() const            {return m_x;}
+    constexpr double        getX() const         {return m_x;} // for boost python wrappers
 
-    void          y(const double& rhs) {m_y = rhs;}
-    const double& y() const            {return m_y;}
-    double        getY() const         {return m_y;} // for boost python wrappers
+    void                    y(const double& rhs) {m_y = rhs;}
+    constexpr const double& y() const            {return m_y;}
+    constexpr double        getY() const         {return m_y;} // for boost python wrappers
 
-    void          z(const double& rhs) {m_z = rhs;}
-    const double& z() const            {return m_z;}
-    double        getZ() const         {return m_z;} // for boost python wrappers
+    void                    z(const double& rhs) {m_z = rhs;}
+    constexpr const double& z() const            {return m_z;}
+    constexpr double        getZ() const         {return m_z;} // for boost python wrappers
 
     // ----- bool operators -----
 
-    bool operator==(const Cartesian& rhs) const;
-    bool operator!=(const Cartesian& rhs) const;
+    constexpr bool operator==(const Cartesian& rhs) const {
+      return m_x == rhs.m_x && m_y == rhs.m_y && m_z == rhs.m_z;
+    }
 
-    // ----- in-place operators -----
+    constexpr bool operator!=(const Cartesian& rhs) const {return !operator==(rhs);}
 
-    Cartesian& operator+=(const Cartesian& rhs);
-    Cartesian& operator-=(const Cartesian& rhs);
+    // ----- in-place operators -----
 
-    Cartesian& operator*=(const double& rhs); // scale
-    Cartesian& operator/=(const double& rhs);
+    Cartesian& operator+=(const Cartesian& rhs) {
+      m_x += rhs.m_x;
+      m_y += rhs.m_y;
+      m_z += rhs.m_z;
+      return *this;
+    }
+
+    Cartesian& operator-=(const Cartesian& rhs) {
+      m_x -= rhs.m_x;
+      m_y -= rhs.m_y;
+      m_z -= rhs.m_z;
+      return *this;
+    }
+
+    Cartesian& operator*=(const double& rhs) { // scale
+      m_x *= rhs;
+      m_y *= rhs;
+      m_z *= rhs;
+      return *this;
+    }
+
+    Cartesian& operator/=(const double& rhs) {
+      if (rhs == 0)
+	throw DivideByZeroError();
+      m_x /= rhs;
+      m_y /= rhs;
+      m_z /= rhs;
+      return *this;
+    }
 
     // ----- other methods -----
 
     void zero() {x(0.0); y(0.0); z(0.0);};
 
-    double magnitude()  const;
-    double magnitude2() const;
+    double           magnitude()  const {return sqrt(magnitude2());}
+    constexpr double magnitude2() const {return m_x*m_x + m_y*m_y + m_z*m_z;}
 
-    Cartesian normalized() const;
+    Cartesian normalized() const {
+      const double h(magnitude());
+      return Cartesian(m_x/h, m_y/h, m_z/h);
+    }
 
   private:
 
@@ -114,22 +143,58 @@ namespace Coords {
   // ----- operators -----
   // ---------------------
 
-  Cartesian operator+(const Cartesian& lhs, const Cartesian& rhs);
-  Cartesian operator-(const Cartesian& lhs, const Cartesian& rhs);
-  Cartesian operator-(const Cartesian& rhs); // unary minus
+  // inline in the header so F = m*a compiles to straight line code
+  // without LTO.
+
+  constexpr Cartesian operator+(const Cartesian& lhs, const Cartesian& rhs) {
+    return Cartesian(lhs.x() + rhs.x(), lhs.y() + rhs.y(), lhs.z() + rhs.z());
+  }
+
+  constexpr Cartesian operator-(const Cartesian& lhs, const Cartesian& rhs) {
+    return Cartesian(lhs.x() - rhs.x(), lhs.y() - rhs.y(), lhs.z() - rhs.z());
+  }
+
+  constexpr Cartesian operator-(const Cartesian& rhs) { // unary minus
+    return Cartesian(-rhs.x(), -rhs.y(), -rhs.z());
+  }
 
 
   // explicit double cast to force scale and not dot product of default Cartesian ctor.
-  Cartesian operator*(const Cartesian& lhs, const double& rhs); // scale
-  Cartesian operator*(const double& lhs, const Cartesian& rhs); // scale
+  constexpr Cartesian operator*(const Cartesian& lhs, const double& rhs) { // scale
+    return Cartesian(lhs.x() * rhs, lhs.y() * rhs, lhs.z() * rhs);
+  }
 
-  Cartesian operator/(const Cartesian& lhs, const double& rhs); // scale
-  Cartesian operator/(const double& lhs, const Cartesian& rhs); // scale
+  constexpr Cartesian operator*(const double& lhs, const Cartesian& rhs) { // scale
+    return rhs * lhs;
+  }
+
+  inline Cartesian operator/(const Cartesian& lhs, const double& rhs) { // scale
+    if (rhs == 0)
+      throw DivideByZeroError();
+    return Cartesian(lhs.x() / rhs, lhs.y() / rhs, lhs.z() / rhs);
+  }
+
+  inline Cartesian operator/(const double& lhs, const Cartesian& rhs) { // scale
+    if (rhs.x() == 0 || rhs.y() == 0 || rhs.z() == 0)
+      throw DivideByZeroError();
+    return Cartesian(lhs / rhs.x(), lhs / rhs.y(), lhs / rhs.z());
+  }
 
   // vector products
-  double operator*(const Cartesian& lhs, const Cartesian& rhs); // dot product
-  double dot(const Cartesian& a, const Cartesian& b);  // vector dot product
-  Cartesian cross(const Cartesian& a, const Cartesian& b);  // vector cross product
+
+  constexpr double operator*(const Cartesian& lhs, const Cartesian& rhs) { // dot product
+    return lhs.x()*rhs.x() + lhs.y()*rhs.y() + lhs.z()*rhs.z();
+  }
+
+  constexpr double dot(const Cartesian& a, const Cartesian& b) { // vector dot product
+    return a * b;
+  }
+
+  constexpr Cartesian cross(const Cartesian& a, const Cartesian& b) { // vector cross product
+    return Cartesian(a.y()*b.z() - a.z()*b.y(),
+		     a.z()*b.x() - a.x()*b.z(),
+		     a.x()*b.y() - a.y()*b.x());
+  }
 
   // -------------------------------
   // ----- output operator<<() -----
@@ -146,15 +211,81 @@ namespace Coords {
   }
 
 
+  // --------------------------
+  // ----- class rotation -----
+  // --------------------------
+
+  // A rotation matrix. Rotations compose with operator* so a chain of
+  // rotations is multiplied into one matrix once and then applied to
+  // each vector in one pass.
+  //
+  //   rotation r(rotation(Uz, lst) * rotation(Uy, colatitude));
+  //   r.apply(stars, stars);
+  //
+  // As with matrices, (a * b).apply(v) == a.apply(b.apply(v)), i.e. b
+  // is applied first.
+
+  class rotation {
+  public:
+
+    rotation(); // identity
+    rotation(const Cartesian& an_axis, const angle& an_angle); // right hand rule
+    rotation(const Cartesian& an_axis, const cachedAngle& an_angle); // its sin and cos
+    rotation(const Cartesian& an_axis, const double& a_cos, const double& a_sin); // of the angle
+
+    // The compiler generated copy and destructor keep rotation
+    // trivially copyable.
+
+    // row, column
+    const double& operator()(const unsigned int& i, const unsigned int& j) const {return m_matrix[i][j];}
+
+    rotation inverse() const; // transpose
+
+    Cartesian apply(const Cartesian& a_vector) const {
+      return Cartesian(m_matrix[0][0]*a_vector.x() +
+		       m_matrix[0][1]*a_vector.y() +
+		       m_matrix[0][2]*a_vector.z(),
+		       m_matrix[1][0]*a_vector.x() +
+		       m_matrix[1][1]*a_vector.y() +
+		       m_matrix[1][2]*a_vector.z(),
+		       m_matrix[2][0]*a_vector.x() +
+		       m_matrix[2][1]*a_vector.y() +
+		       m_matrix[2][2]*a_vector.z());
+    }
+
+    // Batch apply. The result may be the vectors argument. Defined in
+    // CartesianArray.cpp to be compiled with BATCHFLAGS.
+    void           apply(const CartesianArray& vectors, CartesianArray& result) const;
+    CartesianArray apply(const CartesianArray& vectors) const;
+
+    friend rotation operator*(const rotation& lhs, const rotation& rhs);
+
+  private:
+
+    void build(const Cartesian& axis, const double& c, const double& s); // unit axis
+
+    double m_matrix[3][3]; // row major
+
+  };
+
+  rotation operator*(const rotation& lhs, const rotation& rhs); // compose
+
+
   // -------------------------
   // ----- class rotator -----
   // -------------------------
 
   // supports rotating Cartesian vectors about Cartesian axies.
 
+  // The rotation matrices of the last cache_size (axis, angle) pairs
+  // are kept so cycling through a few fixed angles or axes does not
+  // recompute the trig. The least recently used matrix is replaced.
+
   class rotator {
   public:
 
+    static const unsigned int cache_size = 8; // matrices kept
+
     rotator(const Cartesian& an_axis=Coords::Cartesian::Uz); // ctor
     ~rotator() {}; // dtor
 
@@ -162,6 +293,21 @@ namespace Coords {
     void             axis(const Cartesian& an_axis);
 
     Cartesian rotate(const Cartesian& a_vector, const angle& an_angle);
+    Cartesian rotate(const Cartesian& a_vector, const cachedAngle& an_angle);
+
+    // Batch rotate. Builds the matrix once and applies it to every
+    // element. The result may be the vectors argument.
+    void           rotate(const CartesianArray& vectors, const angle& an_angle, CartesianArray& result);
+    CartesianArray rotate(const CartesianArray& vectors, const angle& an_angle);
+
+    // The rotation about axis() by an_angle, from the cache. Use to
+    // compose a rotator into a rotation chain.
+    const rotation& matrix(const angle& an_angle);
+    const rotation& matrix(const cachedAngle& an_angle); // trig from an_angle on a miss
+
+    // matrix cache statistics
+    const unsigned long& cacheHits() const   {return m_cache_hits;}
+    const unsigned long& cacheMisses() const {return m_cache_misses;}
 
     // Boost needs this
     rotator(const rotator& a);
@@ -169,12 +315,25 @@ namespace Coords {
 
   private:
 
-    Cartesian                          m_axis;
-    std::vector< std::vector<double> > m_rotation_matrix;
-
-    // for optimization
-    bool  m_is_new_axis;
-    angle m_current_angle;
+    // No heap and all zeros is an empty cache so zero filled memory,
+    // e.g. from the Python Manual wrapper, is a valid rotator.
+    struct cachedMatrix {
+      Cartesian     axis;
+      double        degrees;
+      rotation      matrix;
+      unsigned long last_used; // zero is empty
+    };
+
+    // true with an_index of the matching entry or false with an_index
+    // of the entry replaced for a_degrees, matrix left to the caller.
+    bool lookup(const double& a_degrees, unsigned int& an_index);
+
+    Cartesian     m_axis;
+    cachedMatrix  m_cache[cache_size];
+    unsigned int  m_current;   // entry used by the last rotate
+    unsigned long m_clock;     // for least recently used
+    unsigned long m_cache_hits;
+    unsigned long m_cache_misses;
 
   };
 
@@ -183,9 +342,10 @@ namespace Coords {
   // ----- class CartesianRecorder -----
   // -----------------------------------
 
-  // implements a simple deque to store three Cartesian data.  It is
-  // intended to store and later plot positions and other three
-  // Cartesian data.
+  // implements a fixed capacity ring buffer to store three Cartesian
+  // data. It is intended to store and later plot positions and other
+  // three Cartesian data. Once full each push replaces the oldest
+  // point. Index 0 is the oldest point.
 
   class CartesianRecorderIOError : public Error {
   public:
@@ -197,7 +357,7 @@ namespace Coords {
 
   public:
 
-    static const unsigned int default_size; /// default size limit for deque
+    static const unsigned int default_size; /// default size limit
 
     CartesianRecorder(const unsigned int& a_size_limit=CartesianRecorder::default_size);
     ~CartesianRecorder() {}; // dtor
@@ -206,22 +366,62 @@ namespace Coords {
     CartesianRecorder& operator=(const CartesianRecorder& a); // copy assignment
 
     const unsigned int& sizeLimit() const       {return m_size_limit;}
-    void                sizeLimit(const int& a) {m_size_limit = a;}
-
-    unsigned long size() const            {return m_data.size();}
-    const Cartesian& get(const unsigned int& idx) {return m_data[idx];}
-
-    void push(Cartesian a);
-    void clear() {m_data.clear();}
-
-    void write2R(const std::string& flnm, bool skip_Uo=true);
+    void                sizeLimit(const int& a); // keeps the newest points
+
+    unsigned long size() const {return m_size;} // points recorded, at most sizeLimit()
+
+    const Cartesian& get(const unsigned int& idx) const {
+      const unsigned long k(m_head + idx);
+      return m_data[k < m_size_limit ? k : k - m_size_limit];
+    }
+
+    void push(const Cartesian& a) {
+      if (m_size_limit == 0)
+	return;
+      m_data[m_tail] = a;
+      if (++m_tail == m_size_limit)
+	m_tail = 0;
+      if (m_size < m_size_limit)
+	++m_size;
+      else
+	m_head = m_tail;
+    }
+
+    void clear() {m_head = m_tail = m_size = 0;}
+
+    // The points oldest first are firstSegment() followed by
+    // secondSegment(). The second is empty until the buffer wraps.
+    const Cartesian* firstSegment() const  {return m_data.data() + m_head;}
+    unsigned long    firstSegmentSize() const {
+      return m_head + m_size <= m_size_limit ? m_size : m_size_limit - m_head;
+    }
+
+    const Cartesian* secondSegment() const {return m_data.data();}
+    unsigned long    secondSegmentSize() const {return m_size - firstSegmentSize();}
+
+    // output compatible for R frames <- read.table(flnm). Buffered,
+    // the text matches the ostream defaults, i.e. %g.
+    void write2R(const std::string& flnm, bool skip_Uo=false);
+
+    // Binary columns, oldest first, read back with CartesianRecording.
+    //
+    //   char     magic[8]    "CRDREC01"
+    //   uint64_t size
+    //   double   x[size], y[size], z[size]
+    //
+    // in host byte order.
+    void write2Binary(const std::string& flnm) const;
+
+    static const char binary_magic[8];
 
   private:
 
-    unsigned int       m_size_limit; /// size limit of position deque
-
-    std::deque<Cartesian>  m_data;       /// data deque
+    unsigned int           m_size_limit; /// capacity
+    std::vector<Cartesian> m_data;       /// storage, allocated once
 
+    unsigned long m_head; /// index of the oldest point
+    unsigned long m_tail; /// index of the next push
+    unsigned long m_size; /// number of points recorded
 
   };
 
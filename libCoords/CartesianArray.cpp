@@ -0,0 +1,346 @@
+// ==================================================================
+// Filename:    CartesianArray.cpp
+//
+// Description: Implements the CartesianArray class, the batch
+//              operators and the batch rotation apply.
+//
+//              The kernels are plain loops over the columns. They are
+//              compiled with BATCHFLAGS (see the Makefile) so gcc and
+//              clang vectorize them for the target, SSE2 by default
+//              or AVX2/AVX-512 with e.g. make SIMDFLAGS=-mavx2.
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coordinates is free software: you can redistribute it and/or
+//  modify it under the terms of the GNU General Public License as
+//  published by the Free Software Foundation, either version 3 of the
+//  License, or (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ==================================================================
+
+#include <cmath>
+
+#include <angle.h>
+#include <Cartesian.h>
+#include <CartesianArray.h>
+#include <utils.h>
+
+// -------------------
+// ----- kernels -----
+// -------------------
+
+// Each element only depends on the same element of the arguments so
+// a result column may also be an argument column.
+
+namespace {
+
+  void add_kernel(const double* a, const double* b, double* result, const unsigned long& n) {
+    for (unsigned long i = 0; i < n; ++i)
+      result[i] = a[i] + b[i];
+  }
+
+  void subtract_kernel(const double* a, const double* b, double* result, const unsigned long& n) {
+    for (unsigned long i = 0; i < n; ++i)
+      result[i] = a[i] - b[i];
+  }
+
+  void scale_kernel(const double* a, const double s, double* result, const unsigned long& n) {
+    for (unsigned long i = 0; i < n; ++i)
+      result[i] = a[i] * s;
+  }
+
+  void divide_kernel(const double* a, const double s, double* result, const unsigned long& n) {
+    for (unsigned long i = 0; i < n; ++i)
+      result[i] = a[i] / s;
+  }
+
+  void dot_kernel(const double* ax, const double* ay, const double* az,
+		  const double* bx, const double* by, const double* bz,
+		  double* result, const unsigned long& n) {
+    for (unsigned long i = 0; i < n; ++i)
+      result[i] = ax[i]*bx[i] + ay[i]*by[i] + az[i]*bz[i];
+  }
+
+  void cross_kernel(const double* ax, const double* ay, const double* az,
+		    const double* bx, const double* by, const double* bz,
+		    double* rx, double* ry, double* rz, const unsigned long& n) {
+    for (unsigned long i = 0; i < n; ++i) {
+      // local copies so the result may be one of the arguments
+      const double x(ay[i]*bz[i] - az[i]*by[i]);
+      const double y(az[i]*bx[i] - ax[i]*bz[i]);
+      const double z(ax[i]*by[i] - ay[i]*bx[i]);
+      rx[i] = x;
+      ry[i] = y;
+      rz[i] = z;
+    }
+  }
+
+  void magnitude_kernel(const double* x, const double* y, const double* z,
+			double* result, const unsigned long& n) {
+    for (unsigned long i = 0; i < n; ++i)
+      result[i] = sqrt(x[i]*x[i] + y[i]*y[i] + z[i]*z[i]);
+  }
+
+  void normalized_kernel(const double* x, const double* y, const double* z,
+			 double* rx, double* ry, double* rz, const unsigned long& n) {
+    for (unsigned long i = 0; i < n; ++i) {
+      const double h(sqrt(x[i]*x[i] + y[i]*y[i] + z[i]*z[i]));
+      const double nx(x[i]/h);
+      const double ny(y[i]/h);
+      const double nz(z[i]/h);
+      rx[i] = nx;
+      ry[i] = ny;
+      rz[i] = nz;
+    }
+  }
+
+  void rotate_kernel(const Coords::rotation& m,
+		     const double* x, const double* y, const double* z,
+		     double* rx, double* ry, double* rz, const unsigned long& n) {
+    // matrix in locals so the compiler keeps it in registers
+    const double m00(m(0, 0)), m01(m(0, 1)), m02(m(0, 2));
+    const double m10(m(1, 0)), m11(m(1, 1)), m12(m(1, 2));
+    const double m20(m(2, 0)), m21(m(2, 1)), m22(m(2, 2));
+    for (unsigned long i = 0; i < n; ++i) {
+      const double tx(m00*x[i] + m01*y[i] + m02*z[i]);
+      const double ty(m10*x[i] + m11*y[i] + m12*z[i]);
+      const double tz(m20*x[i] + m21*y[i] + m22*z[i]);
+      rx[i] = tx;
+      ry[i] = ty;
+      rz[i] = tz;
+    }
+  }
+
+  void check_size(const Coords::CartesianArray& a, const Coords::CartesianArray& b) {
+    if (a.size() != b.size())
+      throw Coords::CartesianArraySizeError();
+  }
+
+} // end anonymous namespace
+
+
+// --------------------------------
+// ----- class CartesianArray -----
+// --------------------------------
+
+Coords::CartesianArray::CartesianArray(const std::vector<Coords::Cartesian>& a)
+  : m_x(a.size()), m_y(a.size()), m_z(a.size()) {
+  for (unsigned long i = 0; i < a.size(); ++i)
+    set(i, a[i]);
+}
+
+void Coords::CartesianArray::resize(const unsigned long& a_size) {
+  m_x.resize(a_size, 0.0);
+  m_y.resize(a_size, 0.0);
+  m_z.resize(a_size, 0.0);
+}
+
+void Coords::CartesianArray::reserve(const unsigned long& a_size) {
+  m_x.reserve(a_size);
+  m_y.reserve(a_size);
+  m_z.reserve(a_size);
+}
+
+void Coords::CartesianArray::clear() {
+  m_x.clear();
+  m_y.clear();
+  m_z.clear();
+}
+
+void Coords::CartesianArray::push_back(const Coords::Cartesian& a) {
+  m_x.push_back(a.x());
+  m_y.push_back(a.y());
+  m_z.push_back(a.z());
+}
+
+void Coords::CartesianArray::store(std::vector<Coords::Cartesian>& a) const {
+  a.resize(size());
+  for (unsigned long i = 0; i < size(); ++i)
+    a[i] = get(i);
+}
+
+// ----- bool operators -----
+
+bool Coords::CartesianArray::operator==(const Coords::CartesianArray& rhs) const {
+  return m_x == rhs.m_x && m_y == rhs.m_y && m_z == rhs.m_z;
+}
+
+bool Coords::CartesianArray::operator!=(const Coords::CartesianArray& rhs) const {
+  return !operator==(rhs);
+}
+
+// ----- in-place operators -----
+
+Coords::CartesianArray& Coords::CartesianArray::operator+=(const Coords::CartesianArray& rhs) {
+  add(*this, rhs, *this);
+  return *this;
+}
+
+Coords::CartesianArray& Coords::CartesianArray::operator-=(const Coords::CartesianArray& rhs) {
+  subtract(*this, rhs, *this);
+  return *this;
+}
+
+Coords::CartesianArray& Coords::CartesianArray::operator*=(const double& rhs) {
+  scale(*this, rhs, *this);
+  return *this;
+}
+
+Coords::CartesianArray& Coords::CartesianArray::operator/=(const double& rhs) {
+  if (rhs == 0)
+    throw DivideByZeroError();
+  divide_kernel(x(), rhs, x(), size());
+  divide_kernel(y(), rhs, y(), size());
+  divide_kernel(z(), rhs, z(), size());
+  return *this;
+}
+
+// ---------------------------
+// ----- batch operators -----
+// ---------------------------
+
+void Coords::add(const Coords::CartesianArray& a,
+		 const Coords::CartesianArray& b,
+		 Coords::CartesianArray& result) {
+  check_size(a, b);
+  result.resize(a.size());
+  add_kernel(a.x(), b.x(), result.x(), a.size());
+  add_kernel(a.y(), b.y(), result.y(), a.size());
+  add_kernel(a.z(), b.z(), result.z(), a.size());
+}
+
+void Coords::subtract(const Coords::CartesianArray& a,
+		      const Coords::CartesianArray& b,
+		      Coords::CartesianArray& result) {
+  check_size(a, b);
+  result.resize(a.size());
+  subtract_kernel(a.x(), b.x(), result.x(), a.size());
+  subtract_kernel(a.y(), b.y(), result.y(), a.size());
+  subtract_kernel(a.z(), b.z(), result.z(), a.size());
+}
+
+void Coords::scale(const Coords::CartesianArray& a,
+		   const double& s,
+		   Coords::CartesianArray& result) {
+  result.resize(a.size());
+  scale_kernel(a.x(), s, result.x(), a.size());
+  scale_kernel(a.y(), s, result.y(), a.size());
+  scale_kernel(a.z(), s, result.z(), a.size());
+}
+
+void Coords::dot(const Coords::CartesianArray& a,
+		 const Coords::CartesianArray& b,
+		 std::vector<double>& result) {
+  check_size(a, b);
+  result.resize(a.size());
+  dot_kernel(a.x(), a.y(), a.z(), b.x(), b.y(), b.z(), result.data(), a.size());
+}
+
+void Coords::cross(const Coords::CartesianArray& a,
+		   const Coords::CartesianArray& b,
+		   Coords::CartesianArray& result) {
+  check_size(a, b);
+  result.resize(a.size());
+  cross_kernel(a.x(), a.y(), a.z(), b.x(), b.y(), b.z(),
+	       result.x(), result.y(), result.z(), a.size());
+}
+
+void Coords::magnitude(const Coords::CartesianArray& a, std::vector<double>& result) {
+  result.resize(a.size());
+  magnitude_kernel(a.x(), a.y(), a.z(), result.data(), a.size());
+}
+
+void Coords::magnitude2(const Coords::CartesianArray& a, std::vector<double>& result) {
+  result.resize(a.size());
+  dot_kernel(a.x(), a.y(), a.z(), a.x(), a.y(), a.z(), result.data(), a.size());
+}
+
+void Coords::normalized(const Coords::CartesianArray& a, Coords::CartesianArray& result) {
+  result.resize(a.size());
+  normalized_kernel(a.x(), a.y(), a.z(), result.x(), result.y(), result.z(), a.size());
+}
+
+// ---------------------
+// ----- operators -----
+// ---------------------
+
+Coords::CartesianArray Coords::operator+(const Coords::CartesianArray& lhs,
+					 const Coords::CartesianArray& rhs) {
+  Coords::CartesianArray sum;
+  Coords::add(lhs, rhs, sum);
+  return sum;
+}
+
+Coords::CartesianArray Coords::operator-(const Coords::CartesianArray& lhs,
+					 const Coords::CartesianArray& rhs) {
+  Coords::CartesianArray diff;
+  Coords::subtract(lhs, rhs, diff);
+  return diff;
+}
+
+Coords::CartesianArray Coords::operator-(const Coords::CartesianArray& rhs) {
+  Coords::CartesianArray neg;
+  Coords::scale(rhs, -1.0, neg);
+  return neg;
+}
+
+Coords::CartesianArray Coords::operator*(const Coords::CartesianArray& lhs,
+					 const double& rhs) {
+  Coords::CartesianArray product;
+  Coords::scale(lhs, rhs, product);
+  return product;
+}
+
+Coords::CartesianArray Coords::operator*(const double& lhs,
+					 const Coords::CartesianArray& rhs) {
+  return Coords::operator*(rhs, lhs);
+}
+
+Coords::CartesianArray Coords::operator/(const Coords::CartesianArray& lhs,
+					 const double& rhs) {
+  if (rhs == 0)
+    throw DivideByZeroError();
+  Coords::CartesianArray quotient(lhs);
+  quotient /= rhs;
+  return quotient;
+}
+
+
+// ------------------------
+// ----- batch rotate -----
+// ------------------------
+
+void Coords::rotation::apply(const Coords::CartesianArray& vectors,
+			     Coords::CartesianArray& result) const {
+  result.resize(vectors.size());
+  rotate_kernel(*this, vectors.x(), vectors.y(), vectors.z(),
+		result.x(), result.y(), result.z(), vectors.size());
+}
+
+Coords::CartesianArray Coords::rotation::apply(const Coords::CartesianArray& vectors) const {
+  Coords::CartesianArray rotated;
+  apply(vectors, rotated);
+  return rotated;
+}
+
+void Coords::rotator::rotate(const Coords::CartesianArray& vectors,
+			     const Coords::angle& an_angle,
+			     Coords::CartesianArray& result) {
+  matrix(an_angle).apply(vectors, result);
+}
+
+Coords::CartesianArray Coords::rotator::rotate(const Coords::CartesianArray& vectors,
+					       const Coords::angle& an_angle) {
+  Coords::CartesianArray rotated;
+  rotate(vectors, an_angle, rotated);
+  return rotated;
+}
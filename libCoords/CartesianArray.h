@@ -0,0 +1,140 @@
+// ================================================================
+// Filename:    CartesianArray.h
+//
+// Description: This defines a structure of arrays container for
+//              Cartesian vectors. The x, y and z components are kept
+//              in separate contiguous columns so the batch operators
+//              below run as simple loops the compiler can vectorize.
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coords is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coords is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coords.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#pragma once
+
+#include <vector>
+
+#include <angle.h>
+#include <Cartesian.h>
+#include <utils.h>
+
+namespace Coords {
+
+  // --------------------------------
+  // ----- class CartesianArray -----
+  // --------------------------------
+
+  class CartesianArraySizeError : public Error {
+  public:
+  CartesianArraySizeError(const std::string& msg="Cartesian array sizes do not match") : Error(msg) {}
+  };
+
+
+  class CartesianArray {
+  public:
+
+    // ----- ctor and dtor -----
+
+    explicit CartesianArray(const unsigned long& a_size = 0) // zero filled
+      : m_x(a_size, 0.0), m_y(a_size, 0.0), m_z(a_size, 0.0) {};
+
+    explicit CartesianArray(const std::vector<Cartesian>& a); // load
+
+    ~CartesianArray() {};
+
+    // ----- accessors -----
+
+    unsigned long size() const  {return m_x.size();}
+    bool          empty() const {return m_x.empty();}
+
+    void resize(const unsigned long& a_size);
+    void reserve(const unsigned long& a_size);
+    void clear();
+
+    // columns
+    double*       x()       {return m_x.data();}
+    const double* x() const {return m_x.data();}
+
+    double*       y()       {return m_y.data();}
+    const double* y() const {return m_y.data();}
+
+    double*       z()       {return m_z.data();}
+    const double* z() const {return m_z.data();}
+
+    // scalar load and store
+    Cartesian get(const unsigned long& idx) const {return Cartesian(m_x[idx], m_y[idx], m_z[idx]);}
+
+    void set(const unsigned long& idx, const Cartesian& a) {
+      m_x[idx] = a.x();
+      m_y[idx] = a.y();
+      m_z[idx] = a.z();
+    }
+
+    void push_back(const Cartesian& a);
+
+    void store(std::vector<Cartesian>& a) const;
+
+    // ----- bool operators -----
+
+    bool operator==(const CartesianArray& rhs) const;
+    bool operator!=(const CartesianArray& rhs) const;
+
+    // ----- in-place operators -----
+
+    CartesianArray& operator+=(const CartesianArray& rhs);
+    CartesianArray& operator-=(const CartesianArray& rhs);
+
+    CartesianArray& operator*=(const double& rhs); // scale
+    CartesianArray& operator/=(const double& rhs);
+
+  private:
+
+    // ----- data members -----
+
+    std::vector<double> m_x, m_y, m_z;
+
+  };
+
+
+  // ---------------------------
+  // ----- batch operators -----
+  // ---------------------------
+
+  // Element by element versions of the Cartesian operators. The
+  // result may be one of the arguments. Mismatched sizes throw
+  // CartesianArraySizeError.
+
+  void add(const CartesianArray& a, const CartesianArray& b, CartesianArray& result);
+  void subtract(const CartesianArray& a, const CartesianArray& b, CartesianArray& result);
+  void scale(const CartesianArray& a, const double& s, CartesianArray& result);
+
+  void dot(const CartesianArray& a, const CartesianArray& b, std::vector<double>& result);
+  void cross(const CartesianArray& a, const CartesianArray& b, CartesianArray& result);
+
+  void magnitude(const CartesianArray& a, std::vector<double>& result);
+  void magnitude2(const CartesianArray& a, std::vector<double>& result);
+  void normalized(const CartesianArray& a, CartesianArray& result);
+
+  CartesianArray operator+(const CartesianArray& lhs, const CartesianArray& rhs);
+  CartesianArray operator-(const CartesianArray& lhs, const CartesianArray& rhs);
+  CartesianArray operator-(const CartesianArray& rhs); // unary minus
+
+  CartesianArray operator*(const CartesianArray& lhs, const double& rhs); // scale
+  CartesianArray operator*(const double& lhs, const CartesianArray& rhs); // scale
+  CartesianArray operator/(const CartesianArray& lhs, const double& rhs); // scale
+
+} // end namespace Coords
@@ -0,0 +1,283 @@
+// ================================================================
+// Filename:    CartesianArray_unittest.cpp
+// Description: This is the gtest unittest of the CartesianArray batch
+//              operators. Each batch operator is checked against the
+//              scalar Cartesian operator it replaces.
+//
+// Author:      L.R. McFarland, lrm@starbug.com
+// Created:     2026 Oct 16
+// Language:    C++
+//
+// See also: http://code.google.com/p/googletest/wiki/Primer
+//
+//  Coordinates is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <angle.h>
+#include <Cartesian.h>
+#include <CartesianArray.h>
+
+
+namespace {
+
+  // --------------------------------
+  // ----- Fixed CartesianArray -----
+  // --------------------------------
+
+  TEST(FixedCartesianArray, DefaultConstructor) {
+    Coords::CartesianArray a;
+    EXPECT_EQ(0u, a.size());
+    EXPECT_TRUE(a.empty());
+  }
+
+  TEST(FixedCartesianArray, SizeConstructor) {
+    Coords::CartesianArray a(3);
+    EXPECT_EQ(3u, a.size());
+    for (unsigned long i = 0; i < a.size(); ++i)
+      EXPECT_EQ(Coords::Cartesian::Uo, a.get(i));
+  }
+
+  TEST(FixedCartesianArray, LoadStore) {
+    std::vector<Coords::Cartesian> points;
+    points.push_back(Coords::Cartesian::Ux);
+    points.push_back(Coords::Cartesian::Uy);
+    points.push_back(Coords::Cartesian(1, 2, 3));
+
+    Coords::CartesianArray a(points);
+    EXPECT_EQ(3u, a.size());
+    EXPECT_EQ(Coords::Cartesian::Ux, a.get(0));
+    EXPECT_EQ(Coords::Cartesian::Uy, a.get(1));
+    EXPECT_EQ(Coords::Cartesian(1, 2, 3), a.get(2));
+
+    EXPECT_DOUBLE_EQ(1, a.x()[2]);
+    EXPECT_DOUBLE_EQ(2, a.y()[2]);
+    EXPECT_DOUBLE_EQ(3, a.z()[2]);
+
+    a.set(1, Coords::Cartesian::Uz);
+    a.push_back(Coords::Cartesian(-1, -2, -3));
+
+    std::vector<Coords::Cartesian> stored;
+    a.store(stored);
+    ASSERT_EQ(4u, stored.size());
+    EXPECT_EQ(Coords::Cartesian::Uz, stored[1]);
+    EXPECT_EQ(Coords::Cartesian(-1, -2, -3), stored[3]);
+  }
+
+  TEST(FixedCartesianArray, Equivalence) {
+    Coords::CartesianArray a(2);
+    Coords::CartesianArray b(2);
+    EXPECT_TRUE(a == b);
+    b.set(1, Coords::Cartesian::Ux);
+    EXPECT_TRUE(a != b);
+    EXPECT_TRUE(a != Coords::CartesianArray(3));
+  }
+
+  TEST(FixedCartesianArray, SizeMismatch) {
+    Coords::CartesianArray a(2);
+    Coords::CartesianArray b(3);
+    Coords::CartesianArray c;
+    EXPECT_THROW(Coords::add(a, b, c), Coords::CartesianArraySizeError);
+    EXPECT_THROW(a += b, Coords::CartesianArraySizeError);
+    EXPECT_THROW(Coords::cross(a, b, c), Coords::CartesianArraySizeError);
+  }
+
+  TEST(FixedCartesianArray, DivideByZero) {
+    Coords::CartesianArray a(2);
+    EXPECT_THROW(a /= 0, Coords::DivideByZeroError);
+    EXPECT_THROW(a / 0, Coords::DivideByZeroError);
+  }
+
+  // ---------------------------------
+  // ----- Random CartesianArray -----
+  // ---------------------------------
+
+  class RandomCartesianArray : public ::testing::Test {
+    // Creates new random arrays each test. The size is not a
+    // multiple of any vector width to exercise the loop remainders.
+  protected:
+
+    virtual void SetUp() {
+
+      seed = std::chrono::system_clock::now().time_since_epoch().count();
+      lo = -1e3;
+      hi = 1e3;
+      size = 1027;
+
+      std::default_random_engine generator(seed);
+      std::uniform_real_distribution<double> distribution(lo, hi);
+
+      for (unsigned long i = 0; i < size; ++i) {
+	p1.push_back(Coords::Cartesian(distribution(generator),
+				       distribution(generator),
+				       distribution(generator)));
+	p2.push_back(Coords::Cartesian(distribution(generator),
+				       distribution(generator),
+				       distribution(generator)));
+      }
+
+      a1 = Coords::CartesianArray(p1);
+      a2 = Coords::CartesianArray(p2);
+
+      c = distribution(generator);
+
+      axis = Coords::Cartesian(distribution(generator),
+			       distribution(generator),
+			       distribution(generator));
+    }
+
+    virtual void TearDown() {}
+
+    // members
+
+    unsigned int seed;
+    double lo;
+    double hi;
+    unsigned long size;
+
+    std::vector<Coords::Cartesian> p1;
+    std::vector<Coords::Cartesian> p2;
+
+    Coords::CartesianArray a1;
+    Coords::CartesianArray a2;
+
+    double c; // random double
+
+    Coords::Cartesian axis; // random rotation axis
+
+  };
+
+  TEST_F(RandomCartesianArray, Add) {
+    Coords::CartesianArray result(a1 + a2);
+    for (unsigned long i = 0; i < size; ++i)
+      EXPECT_EQ(p1[i] + p2[i], result.get(i));
+  }
+
+  TEST_F(RandomCartesianArray, AddInplace) {
+    a1 += a2;
+    for (unsigned long i = 0; i < size; ++i)
+      EXPECT_EQ(p1[i] + p2[i], a1.get(i));
+  }
+
+  TEST_F(RandomCartesianArray, Subtract) {
+    Coords::CartesianArray result(a1 - a2);
+    for (unsigned long i = 0; i < size; ++i)
+      EXPECT_EQ(p1[i] - p2[i], result.get(i));
+  }
+
+  TEST_F(RandomCartesianArray, UnaryMinus) {
+    Coords::CartesianArray result(-a1);
+    for (unsigned long i = 0; i < size; ++i)
+      EXPECT_EQ(-p1[i], result.get(i));
+  }
+
+  TEST_F(RandomCartesianArray, Scale) {
+    Coords::CartesianArray result(c * a1);
+    Coords::CartesianArray commuted(a1 * c);
+    for (unsigned long i = 0; i < size; ++i) {
+      EXPECT_EQ(c * p1[i], result.get(i));
+      EXPECT_EQ(p1[i] * c, commuted.get(i));
+    }
+  }
+
+  TEST_F(RandomCartesianArray, Divide) {
+    Coords::CartesianArray result(a1 / c);
+    for (unsigned long i = 0; i < size; ++i)
+      EXPECT_EQ(p1[i] / c, result.get(i));
+  }
+
+  TEST_F(RandomCartesianArray, DotProduct) {
+    std::vector<double> result;
+    Coords::dot(a1, a2, result);
+    ASSERT_EQ(size, result.size());
+    for (unsigned long i = 0; i < size; ++i)
+      EXPECT_EQ(Coords::dot(p1[i], p2[i]), result[i]);
+  }
+
+  TEST_F(RandomCartesianArray, CrossProduct) {
+    Coords::CartesianArray result;
+    Coords::cross(a1, a2, result);
+    for (unsigned long i = 0; i < size; ++i)
+      EXPECT_EQ(Coords::cross(p1[i], p2[i]), result.get(i));
+  }
+
+  TEST_F(RandomCartesianArray, CrossProductInplace) {
+    Coords::cross(a1, a2, a1);
+    for (unsigned long i = 0; i < size; ++i)
+      EXPECT_EQ(Coords::cross(p1[i], p2[i]), a1.get(i));
+  }
+
+  TEST_F(RandomCartesianArray, Magnitude) {
+    std::vector<double> result;
+    Coords::magnitude(a1, result);
+    for (unsigned long i = 0; i < size; ++i)
+      EXPECT_EQ(p1[i].magnitude(), result[i]);
+  }
+
+  TEST_F(RandomCartesianArray, Magnitude2) {
+    std::vector<double> result;
+    Coords::magnitude2(a1, result);
+    for (unsigned long i = 0; i < size; ++i)
+      EXPECT_EQ(p1[i].magnitude2(), result[i]);
+  }
+
+  TEST_F(RandomCartesianArray, Normalized) {
+    Coords::CartesianArray result;
+    Coords::normalized(a1, result);
+    for (unsigned long i = 0; i < size; ++i)
+      EXPECT_EQ(p1[i].normalized(), result.get(i));
+  }
+
+  TEST_F(RandomCartesianArray, Rotate) {
+    Coords::rotator r(axis);
+    Coords::angle a(c);
+    Coords::CartesianArray result(r.rotate(a1, a));
+    ASSERT_EQ(size, result.size());
+    for (unsigned long i = 0; i < size; ++i)
+      EXPECT_EQ(r.rotate(p1[i], a), result.get(i));
+  }
+
+  TEST_F(RandomCartesianArray, RotateInplace) {
+    Coords::rotator r(axis);
+    Coords::angle a(c);
+    r.rotate(a1, a, a1);
+    for (unsigned long i = 0; i < size; ++i)
+      EXPECT_EQ(r.rotate(p1[i], a), a1.get(i));
+  }
+
+  TEST_F(RandomCartesianArray, ComposedRotation) {
+    Coords::rotation r(Coords::rotation(axis, Coords::angle(c)) *
+		       Coords::rotation(Coords::Cartesian::Uz, Coords::angle(-c)));
+    Coords::CartesianArray result(r.apply(a1));
+    ASSERT_EQ(size, result.size());
+    for (unsigned long i = 0; i < size; ++i)
+      EXPECT_EQ(r.apply(p1[i]), result.get(i));
+  }
+
+} // end anonymous namespace
+
+
+// ==================
+// ===== main() =====
+// ==================
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,271 @@
+// ================================================================
+// Filename:    CartesianExpression.h
+//
+// Description: Opt-in expression templates for Cartesian and
+//              CartesianArray vector arithmetic. An expression like
+//
+//                x = evaluate(lazy(a) + lazy(v)*dt + lazy(g)*(0.5*dt*dt));
+//
+//              is built as a tree of light weight nodes and computed
+//              in one pass with no intermediate Cartesian or
+//              CartesianArray temporaries. Cartesian terms broadcast
+//              over CartesianArray terms, so with arrays one pass over
+//              the columns replaces one pass per operator.
+//
+//              The leaves refer to their arguments, so evaluate the
+//              expression in the statement that builds it.
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coords is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coords is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coords.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#pragma once
+
+#include <angle.h>
+#include <Cartesian.h>
+#include <CartesianArray.h>
+#include <utils.h>
+
+namespace Coords {
+
+  namespace expression {
+
+    // ----------------------------
+    // ----- vectorExpression -----
+    // ----------------------------
+
+    // Base of every node. size() is the number of elements or zero
+    // for a single Cartesian that is broadcast to every element.
+
+    template <class E>
+    class vectorExpression {
+    public:
+      const E& self() const {return static_cast<const E&>(*this);}
+    };
+
+    inline unsigned long combinedSize(const unsigned long& lhs, const unsigned long& rhs) {
+      if (lhs != 0 && rhs != 0 && lhs != rhs)
+	throw CartesianArraySizeError();
+      return lhs != 0 ? lhs : rhs;
+    }
+
+    // -----------------
+    // ----- terms -----
+    // -----------------
+
+    class CartesianTerm : public vectorExpression<CartesianTerm> {
+    public:
+      explicit CartesianTerm(const Cartesian& a) : m_a(a) {}
+
+      unsigned long size() const {return 0;}
+
+      double x(const unsigned long&) const {return m_a.x();}
+      double y(const unsigned long&) const {return m_a.y();}
+      double z(const unsigned long&) const {return m_a.z();}
+
+    private:
+      const Cartesian& m_a;
+    };
+
+    class CartesianArrayTerm : public vectorExpression<CartesianArrayTerm> {
+    public:
+      explicit CartesianArrayTerm(const CartesianArray& a)
+	: m_size(a.size()), m_x(a.x()), m_y(a.y()), m_z(a.z()) {}
+
+      unsigned long size() const {return m_size;}
+
+      double x(const unsigned long& i) const {return m_x[i];}
+      double y(const unsigned long& i) const {return m_y[i];}
+      double z(const unsigned long& i) const {return m_z[i];}
+
+    private:
+      unsigned long m_size;
+      const double* m_x;
+      const double* m_y;
+      const double* m_z;
+    };
+
+    inline CartesianTerm      lazy(const Cartesian& a)      {return CartesianTerm(a);}
+    inline CartesianArrayTerm lazy(const CartesianArray& a) {return CartesianArrayTerm(a);}
+
+    // -----------------
+    // ----- nodes -----
+    // -----------------
+
+    template <class L, class R>
+    class sum : public vectorExpression< sum<L, R> > {
+    public:
+      sum(const L& lhs, const R& rhs)
+	: m_lhs(lhs), m_rhs(rhs), m_size(combinedSize(lhs.size(), rhs.size())) {}
+
+      unsigned long size() const {return m_size;}
+
+      double x(const unsigned long& i) const {return m_lhs.x(i) + m_rhs.x(i);}
+      double y(const unsigned long& i) const {return m_lhs.y(i) + m_rhs.y(i);}
+      double z(const unsigned long& i) const {return m_lhs.z(i) + m_rhs.z(i);}
+
+    private:
+      L m_lhs;
+      R m_rhs;
+      unsigned long m_size;
+    };
+
+    template <class L, class R>
+    class difference : public vectorExpression< difference<L, R> > {
+    public:
+      difference(const L& lhs, const R& rhs)
+	: m_lhs(lhs), m_rhs(rhs), m_size(combinedSize(lhs.size(), rhs.size())) {}
+
+      unsigned long size() const {return m_size;}
+
+      double x(const unsigned long& i) const {return m_lhs.x(i) - m_rhs.x(i);}
+      double y(const unsigned long& i) const {return m_lhs.y(i) - m_rhs.y(i);}
+      double z(const unsigned long& i) const {return m_lhs.z(i) - m_rhs.z(i);}
+
+    private:
+      L m_lhs;
+      R m_rhs;
+      unsigned long m_size;
+    };
+
+    template <class E>
+    class negation : public vectorExpression< negation<E> > {
+    public:
+      explicit negation(const E& e) : m_e(e) {}
+
+      unsigned long size() const {return m_e.size();}
+
+      double x(const unsigned long& i) const {return -m_e.x(i);}
+      double y(const unsigned long& i) const {return -m_e.y(i);}
+      double z(const unsigned long& i) const {return -m_e.z(i);}
+
+    private:
+      E m_e;
+    };
+
+    template <class E>
+    class scaled : public vectorExpression< scaled<E> > {
+    public:
+      scaled(const E& e, const double& s) : m_e(e), m_s(s) {}
+
+      unsigned long size() const {return m_e.size();}
+
+      double x(const unsigned long& i) const {return m_e.x(i) * m_s;}
+      double y(const unsigned long& i) const {return m_e.y(i) * m_s;}
+      double z(const unsigned long& i) const {return m_e.z(i) * m_s;}
+
+    private:
+      E m_e;
+      double m_s;
+    };
+
+    template <class E>
+    class divided : public vectorExpression< divided<E> > {
+    public:
+      divided(const E& e, const double& s) : m_e(e), m_s(s) {
+	if (s == 0)
+	  throw DivideByZeroError();
+      }
+
+      unsigned long size() const {return m_e.size();}
+
+      double x(const unsigned long& i) const {return m_e.x(i) / m_s;}
+      double y(const unsigned long& i) const {return m_e.y(i) / m_s;}
+      double z(const unsigned long& i) const {return m_e.z(i) / m_s;}
+
+    private:
+      E m_e;
+      double m_s;
+    };
+
+    // ---------------------
+    // ----- operators -----
+    // ---------------------
+
+    template <class L, class R>
+    sum<L, R> operator+(const vectorExpression<L>& lhs, const vectorExpression<R>& rhs) {
+      return sum<L, R>(lhs.self(), rhs.self());
+    }
+
+    template <class L, class R>
+    difference<L, R> operator-(const vectorExpression<L>& lhs, const vectorExpression<R>& rhs) {
+      return difference<L, R>(lhs.self(), rhs.self());
+    }
+
+    template <class E>
+    negation<E> operator-(const vectorExpression<E>& rhs) { // unary minus
+      return negation<E>(rhs.self());
+    }
+
+    template <class E>
+    scaled<E> operator*(const vectorExpression<E>& lhs, const double& rhs) { // scale
+      return scaled<E>(lhs.self(), rhs);
+    }
+
+    template <class E>
+    scaled<E> operator*(const double& lhs, const vectorExpression<E>& rhs) { // scale
+      return scaled<E>(rhs.self(), lhs);
+    }
+
+    template <class E>
+    divided<E> operator/(const vectorExpression<E>& lhs, const double& rhs) { // scale
+      return divided<E>(lhs.self(), rhs);
+    }
+
+    // ----------------------
+    // ----- evaluation -----
+    // ----------------------
+
+    // A Cartesian result needs an expression of only Cartesian terms.
+
+    template <class E>
+    Cartesian evaluate(const vectorExpression<E>& an_expression) {
+      const E& e(an_expression.self());
+      if (e.size() != 0)
+	throw CartesianArraySizeError("CartesianArray expression evaluated as a Cartesian");
+      return Cartesian(e.x(0), e.y(0), e.z(0));
+    }
+
+    // Fills a_result one column at a time. a_result may appear in the
+    // expression. An expression of only Cartesian terms is broadcast
+    // to every element of a_result.
+
+    template <class E>
+    void evaluate(const vectorExpression<E>& an_expression, CartesianArray& a_result) {
+      const E& e(an_expression.self());
+
+      if (e.size() != 0)
+	a_result.resize(e.size());
+
+      const unsigned long n(a_result.size());
+
+      double* x(a_result.x());
+      for (unsigned long i = 0; i < n; ++i)
+	x[i] = e.x(i);
+
+      double* y(a_result.y());
+      for (unsigned long i = 0; i < n; ++i)
+	y[i] = e.y(i);
+
+      double* z(a_result.z());
+      for (unsigned long i = 0; i < n; ++i)
+	z[i] = e.z(i);
+    }
+
+  } // end namespace expression
+
+} // end namespace Coords
@@ -0,0 +1,183 @@
+// ================================================================
+// Filename:    CartesianExpression_unittest.cpp
+// Description: This is the gtest unittest of the Cartesian expression
+//              templates. Fused expressions are checked against the
+//              same expression written with the Cartesian operators.
+//
+// Author:      L.R. McFarland, lrm@starbug.com
+// Created:     2026 Oct 16
+// Language:    C++
+//
+// See also: http://code.google.com/p/googletest/wiki/Primer
+//
+//  Coordinates is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <angle.h>
+#include <Cartesian.h>
+#include <CartesianArray.h>
+#include <CartesianExpression.h>
+
+
+namespace {
+
+  using Coords::expression::lazy;
+  using Coords::expression::evaluate;
+
+  // -----------------------------
+  // ----- Fixed expressions -----
+  // -----------------------------
+
+  TEST(FixedExpression, Sum) {
+    Coords::Cartesian a(1, 2, 3);
+    Coords::Cartesian b(4, 5, 6);
+    EXPECT_EQ(Coords::Cartesian(5, 7, 9), evaluate(lazy(a) + lazy(b)));
+  }
+
+  TEST(FixedExpression, Difference) {
+    Coords::Cartesian a(1, 2, 3);
+    Coords::Cartesian b(4, 5, 6);
+    EXPECT_EQ(Coords::Cartesian(-3, -3, -3), evaluate(lazy(a) - lazy(b)));
+  }
+
+  TEST(FixedExpression, UnaryMinus) {
+    Coords::Cartesian a(1, -2, 3);
+    EXPECT_EQ(Coords::Cartesian(-1, 2, -3), evaluate(-lazy(a)));
+  }
+
+  TEST(FixedExpression, Scale) {
+    Coords::Cartesian a(1, -2, 3);
+    EXPECT_EQ(Coords::Cartesian(2, -4, 6), evaluate(2.0*lazy(a)));
+    EXPECT_EQ(Coords::Cartesian(2, -4, 6), evaluate(lazy(a)*2.0));
+    EXPECT_EQ(Coords::Cartesian(0.5, -1, 1.5), evaluate(lazy(a)/2.0));
+  }
+
+  TEST(FixedExpression, DivideByZero) {
+    Coords::Cartesian a(1, -2, 3);
+    EXPECT_THROW(lazy(a)/0.0, Coords::DivideByZeroError);
+  }
+
+  TEST(FixedExpression, ArrayAsCartesian) {
+    Coords::CartesianArray a(2);
+    EXPECT_THROW(evaluate(lazy(a)), Coords::CartesianArraySizeError);
+  }
+
+  TEST(FixedExpression, SizeMismatch) {
+    Coords::CartesianArray a(2);
+    Coords::CartesianArray b(3);
+    EXPECT_THROW(lazy(a) + lazy(b), Coords::CartesianArraySizeError);
+  }
+
+  TEST(FixedExpression, Broadcast) {
+    Coords::Cartesian a(1, 2, 3);
+    Coords::CartesianArray result(4);
+    evaluate(lazy(a)*2.0, result);
+    for (unsigned long i = 0; i < result.size(); ++i)
+      EXPECT_EQ(Coords::Cartesian(2, 4, 6), result.get(i));
+  }
+
+  // ------------------------------
+  // ----- Random expressions -----
+  // ------------------------------
+
+  class RandomExpression : public ::testing::Test {
+    // Creates new random positions, velocities and accelerations each test.
+  protected:
+
+    virtual void SetUp() {
+
+      seed = std::chrono::system_clock::now().time_since_epoch().count();
+      lo = -1e3;
+      hi = 1e3;
+      size = 513;
+
+      std::default_random_engine generator(seed);
+      std::uniform_real_distribution<double> distribution(lo, hi);
+
+      for (unsigned long i = 0; i < size; ++i) {
+	x.push_back(Coords::Cartesian(distribution(generator),
+				      distribution(generator),
+				      distribution(generator)));
+	v.push_back(Coords::Cartesian(distribution(generator),
+				      distribution(generator),
+				      distribution(generator)));
+      }
+
+      g = Coords::Cartesian(distribution(generator),
+			    distribution(generator),
+			    distribution(generator));
+
+      dt = distribution(generator);
+    }
+
+    virtual void TearDown() {}
+
+    // members
+
+    unsigned int seed;
+    double lo;
+    double hi;
+    unsigned long size;
+
+    std::vector<Coords::Cartesian> x;
+    std::vector<Coords::Cartesian> v;
+    Coords::Cartesian g;
+    double dt;
+
+  };
+
+  TEST_F(RandomExpression, Integrator) {
+    Coords::Cartesian result(x[0] + v[0]*dt + g*(0.5*dt*dt));
+    EXPECT_EQ(result, evaluate(lazy(x[0]) + lazy(v[0])*dt + lazy(g)*(0.5*dt*dt)));
+  }
+
+  TEST_F(RandomExpression, IntegratorArray) {
+    Coords::CartesianArray xa(x);
+    Coords::CartesianArray va(v);
+
+    Coords::CartesianArray result;
+    evaluate(lazy(xa) + lazy(va)*dt + lazy(g)*(0.5*dt*dt), result);
+
+    ASSERT_EQ(size, result.size());
+    for (unsigned long i = 0; i < size; ++i)
+      EXPECT_EQ(x[i] + v[i]*dt + g*(0.5*dt*dt), result.get(i));
+  }
+
+  TEST_F(RandomExpression, IntegratorArrayInplace) {
+    Coords::CartesianArray xa(x);
+    Coords::CartesianArray va(v);
+
+    evaluate(lazy(xa) + lazy(va)*dt - lazy(g)/dt, xa);
+
+    for (unsigned long i = 0; i < size; ++i)
+      EXPECT_EQ(x[i] + v[i]*dt - g/dt, xa.get(i));
+  }
+
+} // end anonymous namespace
+
+
+// ==================
+// ===== main() =====
+// ==================
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
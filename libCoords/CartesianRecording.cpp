@@ -0,0 +1,97 @@
+// ==================================================================
+// Filename:    CartesianRecording.cpp
+//
+// Description: Implements the memory mapped CartesianRecorder binary
+//              file reader.
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coordinates is free software: you can redistribute it and/or
+//  modify it under the terms of the GNU General Public License as
+//  published by the Free Software Foundation, either version 3 of the
+//  License, or (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ==================================================================
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <angle.h>
+#include <Cartesian.h>
+#include <CartesianRecording.h>
+
+namespace {
+
+  const unsigned long s_header_size(sizeof(Coords::CartesianRecorder::binary_magic) + sizeof(uint64_t));
+
+  void throwError(const std::string& flnm, const std::string& why) {
+    std::stringstream err;
+    err << "Error: unable to read file \"" << flnm << "\": " << why;
+    throw Coords::CartesianRecorderIOError(err.str());
+  }
+
+} // end anonymous namespace
+
+
+Coords::CartesianRecording::CartesianRecording(const std::string& flnm)
+  : m_map(0), m_map_size(0), m_size(0), m_x(0), m_y(0), m_z(0) {
+
+  int fd(open(flnm.c_str(), O_RDONLY));
+  if (fd < 0)
+    throwError(flnm, "can not open");
+
+  struct stat status;
+  if (fstat(fd, &status) != 0 || static_cast<unsigned long>(status.st_size) < s_header_size) {
+    close(fd);
+    throwError(flnm, "too short");
+  }
+
+  m_map_size = status.st_size;
+  m_map = mmap(0, m_map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd); // the mapping keeps the file
+
+  if (m_map == MAP_FAILED) {
+    m_map = 0;
+    throwError(flnm, "can not map");
+  }
+
+  const char* bytes(static_cast<const char*>(m_map));
+
+  uint64_t n;
+  memcpy(&n, bytes + sizeof(CartesianRecorder::binary_magic), sizeof(n));
+
+  if (memcmp(bytes, CartesianRecorder::binary_magic, sizeof(CartesianRecorder::binary_magic)) != 0 ||
+      n > m_map_size/(3*sizeof(double)) ||
+      m_map_size != s_header_size + 3*n*sizeof(double)) {
+    munmap(m_map, m_map_size);
+    m_map = 0;
+    throwError(flnm, "not a CartesianRecorder binary file");
+  }
+
+  // the header is a multiple of 8 bytes and the map is page aligned
+  m_size = n;
+  m_x = reinterpret_cast<const double*>(bytes + s_header_size);
+  m_y = m_x + m_size;
+  m_z = m_y + m_size;
+
+}
+
+Coords::CartesianRecording::~CartesianRecording() {
+  if (m_map)
+    munmap(m_map, m_map_size);
+}
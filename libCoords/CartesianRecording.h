@@ -0,0 +1,72 @@
+// ================================================================
+// Filename:    CartesianRecording.h
+//
+// Description: A read only, memory mapped view of a file written by
+//              CartesianRecorder::write2Binary. The x, y and z
+//              columns are used in place without reading or copying
+//              the file.
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coords is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coords is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coords.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#pragma once
+
+#include <string>
+
+#include <Cartesian.h>
+
+namespace Coords {
+
+  // ------------------------------------
+  // ----- class CartesianRecording -----
+  // ------------------------------------
+
+  // Throws CartesianRecorderIOError if the file can not be mapped or
+  // is not a CartesianRecorder binary file.
+
+  class CartesianRecording {
+  public:
+
+    explicit CartesianRecording(const std::string& flnm);
+    ~CartesianRecording();
+
+    CartesianRecording(const CartesianRecording&) = delete;
+    CartesianRecording& operator=(const CartesianRecording&) = delete;
+
+    unsigned long size() const {return m_size;}
+
+    // columns, oldest first
+    const double* x() const {return m_x;}
+    const double* y() const {return m_y;}
+    const double* z() const {return m_z;}
+
+    Cartesian get(const unsigned long& idx) const {return Cartesian(m_x[idx], m_y[idx], m_z[idx]);}
+
+  private:
+
+    void*         m_map;
+    unsigned long m_map_size;
+
+    unsigned long m_size;
+    const double* m_x;
+    const double* m_y;
+    const double* m_z;
+
+  };
+
+} // end namespace Coords
@@ -0,0 +1,164 @@
+// ==================================================================
+// Filename:    CartesianStreamRecorder.cpp
+//
+// Description: Implements the background CartesianStreamRecorder.
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coordinates is free software: you can redistribute it and/or
+//  modify it under the terms of the GNU General Public License as
+//  published by the Free Software Foundation, either version 3 of the
+//  License, or (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ==================================================================
+
+#include <chrono>
+#include <sstream>
+
+#include <angle.h>
+#include <Cartesian.h>
+#include <CartesianStreamRecorder.h>
+
+namespace {
+
+  const unsigned long s_block_size(1 << 20); // bytes formatted per write
+  const unsigned long s_max_row(128);        // longest formatted row
+
+  // writer poll interval when the queue is empty
+  const std::chrono::microseconds s_idle(500);
+
+  unsigned long power_of_two(const unsigned long& n) {
+    unsigned long p(1);
+    while (p < n)
+      p <<= 1;
+    return p;
+  }
+
+} // end anonymous namespace
+
+
+const unsigned long Coords::CartesianStreamRecorder::default_capacity(1 << 16);
+
+Coords::CartesianStreamRecorder::CartesianStreamRecorder(const std::string& flnm,
+							 const unsigned long& a_capacity,
+							 const overflowPolicy& a_policy)
+  : m_flnm(flnm),
+    m_file(fopen(flnm.c_str(), "wb")),
+    m_policy(a_policy),
+    m_queue(power_of_two(a_capacity)),
+    m_mask(m_queue.size() - 1),
+    m_pad0(),
+    m_tail(0),
+    m_pad1(),
+    m_head(0),
+    m_pad2(),
+    m_stalls(0),
+    m_dropped(0),
+    m_closed(false),
+    m_done(false),
+    m_failed(false) {
+
+  if (!m_file) {
+    std::stringstream err;
+    err << "Error: unable to open file \"" << flnm << "\"";
+    throw Coords::CartesianRecorderIOError(err.str());
+  }
+
+  if (fprintf(m_file, "# Formated for R frames <- read.table(%s)\nx y z\n", flnm.c_str()) < 0)
+    m_failed = true;
+
+  m_writer = std::thread(&Coords::CartesianStreamRecorder::writer, this);
+}
+
+Coords::CartesianStreamRecorder::~CartesianStreamRecorder() {
+  try {
+    close();
+  } catch (...) {
+    // destructors do not throw, call close() to see write errors
+  }
+}
+
+bool Coords::CartesianStreamRecorder::waitForRoom(const unsigned long& tail) {
+  ++m_stalls;
+
+  if (m_policy == drop) {
+    ++m_dropped;
+    return false;
+  }
+
+  while (tail - m_head.load(std::memory_order_acquire) > m_mask) {
+    if (m_failed)
+      return false; // the writer is gone, do not wait forever
+    std::this_thread::yield();
+  }
+
+  return true;
+}
+
+void Coords::CartesianStreamRecorder::close() {
+
+  m_closed = true;
+
+  if (m_writer.joinable()) {
+    m_done = true;
+    m_writer.join();
+  }
+
+  if (m_file) {
+    if (fclose(m_file) != 0)
+      m_failed = true;
+    m_file = 0;
+  }
+
+  if (m_failed) {
+    std::stringstream err;
+    err << "Error: unable to write file \"" << m_flnm << "\"";
+    throw Coords::CartesianRecorderIOError(err.str());
+  }
+
+}
+
+void Coords::CartesianStreamRecorder::writer() {
+
+  std::vector<char> block(s_block_size);
+
+  while (true) {
+
+    // read done first so a push before close() is always seen
+    const bool done(m_done);
+
+    unsigned long head(m_head.load(std::memory_order_relaxed));
+    const unsigned long tail(m_tail.load(std::memory_order_acquire));
+
+    if (head == tail) {
+      if (done)
+	return;
+      std::this_thread::sleep_for(s_idle);
+      continue;
+    }
+
+    // format a block of rows then free their queue slots before the write
+    unsigned long used(0);
+    for (; head != tail && s_block_size - used >= s_max_row; ++head) {
+      const Coords::Cartesian& a(m_queue[head & m_mask]);
+      used += snprintf(block.data() + used, s_max_row, "%lu %g %g %g\n",
+		       head, a.x(), a.y(), a.z());
+    }
+
+    m_head.store(head, std::memory_order_release);
+
+    if (!m_failed && fwrite(block.data(), 1, used, m_file) != used)
+      m_failed = true;
+
+  }
+
+}
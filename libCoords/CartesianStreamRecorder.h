@@ -0,0 +1,126 @@
+// ================================================================
+// Filename:    CartesianStreamRecorder.h
+//
+// Description: Records Cartesian data continuously to a file. push()
+//              puts the point on a lock free single producer, single
+//              consumer queue and a background thread drains the
+//              queue to the file in large blocks, so the step loop
+//              does not stop to write. The output is the same R frame
+//              text as CartesianRecorder::write2R.
+//
+//              Memory is bounded by the queue capacity. When the
+//              writer falls behind push() either waits for room or
+//              drops the point, see overflowPolicy, and the
+//              statistics count both.
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coords is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coords is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coords.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#pragma once
+
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Cartesian.h>
+
+namespace Coords {
+
+  // -----------------------------------------
+  // ----- class CartesianStreamRecorder -----
+  // -----------------------------------------
+
+  class CartesianStreamRecorder {
+
+  public:
+
+    enum overflowPolicy {wait, drop};
+
+    static const unsigned long default_capacity; /// queue size, points
+
+    // Opens flnm, writes the header and starts the writer
+    // thread. Throws CartesianRecorderIOError if flnm can not be
+    // opened. The capacity is rounded up to a power of two.
+    CartesianStreamRecorder(const std::string& flnm,
+			    const unsigned long& a_capacity=CartesianStreamRecorder::default_capacity,
+			    const overflowPolicy& a_policy=wait);
+
+    ~CartesianStreamRecorder(); // closes, ignoring errors
+
+    CartesianStreamRecorder(const CartesianStreamRecorder&) = delete;
+    CartesianStreamRecorder& operator=(const CartesianStreamRecorder&) = delete;
+
+    // One producer thread only. Returns false if the point was
+    // dropped or the recorder is closed, nothing drains the queue then.
+    bool push(const Cartesian& a) {
+      if (m_closed)
+	return false;
+      const unsigned long tail(m_tail.load(std::memory_order_relaxed));
+      if (tail - m_head.load(std::memory_order_acquire) > m_mask && !waitForRoom(tail))
+	return false;
+      m_queue[tail & m_mask] = a;
+      m_tail.store(tail + 1, std::memory_order_release);
+      return true;
+    }
+
+    // Drains the queue, stops the writer and closes the
+    // file. Throws CartesianRecorderIOError if a write failed.
+    void close();
+
+    // ----- statistics -----
+
+    unsigned long capacity() const {return m_mask + 1;}
+
+    unsigned long pushed() const  {return m_tail.load(std::memory_order_relaxed);}
+    unsigned long written() const {return m_head.load(std::memory_order_relaxed);}
+    unsigned long stalls() const  {return m_stalls;}  /// pushes that found the queue full
+    unsigned long dropped() const {return m_dropped;} /// points dropped with the drop policy
+
+  private:
+
+    bool waitForRoom(const unsigned long& tail); // false if dropped
+    void writer();                               // background thread
+
+    std::string            m_flnm;
+    FILE*                  m_file;
+    overflowPolicy         m_policy;
+
+    std::vector<Cartesian> m_queue;
+    unsigned long          m_mask;
+
+    // padded onto separate cache lines, written by the producer and
+    // the writer respectively
+    char                       m_pad0[64];
+    std::atomic<unsigned long> m_tail; /// next push
+    char                       m_pad1[64];
+    std::atomic<unsigned long> m_head; /// next write
+    char                       m_pad2[64];
+
+    unsigned long m_stalls;  /// producer only
+    unsigned long m_dropped; /// producer only
+    bool          m_closed;  /// producer only
+
+    std::atomic<bool> m_done;
+    std::atomic<bool> m_failed;
+    std::thread       m_writer;
+
+  };
+
+} // end namespace Coords
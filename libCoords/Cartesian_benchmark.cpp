@@ -0,0 +1,308 @@
+// ================================================================
+// Filename:    Cartesian_benchmark.cpp
+// Description: Benchmarks of Cartesian arithmetic, CartesianArray
+//              batch operators and expression templates, rotator,
+//              rotation and CartesianRecorder.
+//
+//              The *_out_of_line benchmarks are copies of the
+//              operators that can not be inlined, i.e. what a caller
+//              paid when they were only defined in Cartesian.cpp.
+//
+//              Array benchmarks are per call over s_size points.
+//
+// Author:      L.R. McFarland, lrm@starbug.com
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coordinates is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#include <vector>
+
+#include <angle.h>
+#include <benchmark.h>
+#include <Cartesian.h>
+#include <CartesianArray.h>
+#include <CartesianExpression.h>
+#include <fastTrig.h>
+
+#define NOINLINE __attribute__((noinline))
+
+namespace {
+
+  using Coords::benchmark::doNotOptimize;
+
+  // -------------------------------------------
+  // ----- out-of-line (library) reference -----
+  // -------------------------------------------
+
+  NOINLINE Coords::Cartesian lib_add(const Coords::Cartesian& lhs, const Coords::Cartesian& rhs) {
+    return Coords::Cartesian(lhs.x() + rhs.x(), lhs.y() + rhs.y(), lhs.z() + rhs.z());
+  }
+
+  NOINLINE Coords::Cartesian lib_scale(const double& lhs, const Coords::Cartesian& rhs) {
+    return Coords::Cartesian(rhs.x() * lhs, rhs.y() * lhs, rhs.z() * lhs);
+  }
+
+  NOINLINE double lib_dot(const Coords::Cartesian& lhs, const Coords::Cartesian& rhs) {
+    return lhs.x()*rhs.x() + lhs.y()*rhs.y() + lhs.z()*rhs.z();
+  }
+
+  NOINLINE Coords::Cartesian lib_cross(const Coords::Cartesian& a, const Coords::Cartesian& b) {
+    Coords::Cartesian tmp;
+    tmp.x(a.y()*b.z() - a.z()*b.y());
+    tmp.y(a.z()*b.x() - a.x()*b.z());
+    tmp.z(a.x()*b.y() - a.y()*b.x());
+    return tmp;
+  }
+
+  // ----------------
+  // ----- data -----
+  // ----------------
+
+  const unsigned long s_size(4096);
+
+  std::vector<Coords::Cartesian> points() {
+    std::vector<Coords::Cartesian> a(s_size);
+    for (unsigned long i = 0; i < s_size; ++i)
+      a[i] = Coords::Cartesian(i, 1.0/(i+1), 0.5*i);
+    return a;
+  }
+
+  const std::vector<Coords::Cartesian> s_points(points());
+  const Coords::CartesianArray         s_array(s_points);
+
+  const Coords::Cartesian s_a(1, 2, 3);
+  const Coords::Cartesian s_b(-4, 5, 0.25);
+  const Coords::Cartesian s_g(0, 0, -9.8);
+  const double            s_dt(0.01);
+
+  // ---------------------
+  // ----- Cartesian -----
+  // ---------------------
+
+  COORDS_BENCHMARK(Cartesian_add) {
+    Coords::Cartesian a(s_a);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(a);
+      doNotOptimize(a + s_b);
+    }
+  }
+
+  COORDS_BENCHMARK(Cartesian_add_out_of_line) {
+    Coords::Cartesian a(s_a);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(a);
+      doNotOptimize(lib_add(a, s_b));
+    }
+  }
+
+  COORDS_BENCHMARK(Cartesian_scale) {
+    Coords::Cartesian a(s_a);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(a);
+      doNotOptimize(s_dt * a);
+    }
+  }
+
+  COORDS_BENCHMARK(Cartesian_scale_out_of_line) {
+    Coords::Cartesian a(s_a);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(a);
+      doNotOptimize(lib_scale(s_dt, a));
+    }
+  }
+
+  COORDS_BENCHMARK(Cartesian_dot) {
+    Coords::Cartesian a(s_a);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(a);
+      doNotOptimize(a * s_b);
+    }
+  }
+
+  COORDS_BENCHMARK(Cartesian_dot_out_of_line) {
+    Coords::Cartesian a(s_a);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(a);
+      doNotOptimize(lib_dot(a, s_b));
+    }
+  }
+
+  COORDS_BENCHMARK(Cartesian_cross) {
+    Coords::Cartesian a(s_a);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(a);
+      doNotOptimize(Coords::cross(a, s_b));
+    }
+  }
+
+  COORDS_BENCHMARK(Cartesian_cross_out_of_line) {
+    Coords::Cartesian a(s_a);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(a);
+      doNotOptimize(lib_cross(a, s_b));
+    }
+  }
+
+  COORDS_BENCHMARK(Cartesian_magnitude) {
+    Coords::Cartesian a(s_a);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(a);
+      doNotOptimize(a.magnitude());
+    }
+  }
+
+  COORDS_BENCHMARK(Cartesian_normalized) {
+    Coords::Cartesian a(s_a);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(a);
+      doNotOptimize(a.normalized());
+    }
+  }
+
+  COORDS_BENCHMARK(Cartesian_string_ctor) {
+    const std::string x("1.5"), y("-2.25"), z("3e2");
+    for (unsigned long i = 0; i < count; ++i)
+      doNotOptimize(Coords::Cartesian(x, y, z));
+  }
+
+  // --------------------------
+  // ----- CartesianArray -----
+  // --------------------------
+
+  COORDS_BENCHMARK(CartesianArray_add_4096) {
+    Coords::CartesianArray result(s_size);
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::add(s_array, s_array, result);
+      doNotOptimize(result.x()[0]);
+    }
+  }
+
+  COORDS_BENCHMARK(CartesianArray_normalized_4096) {
+    Coords::CartesianArray result(s_size);
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::normalized(s_array, result);
+      doNotOptimize(result.x()[0]);
+    }
+  }
+
+  // x + v*dt + g*dt^2/2, one temporary per operator
+  COORDS_BENCHMARK(CartesianArray_step_eager_4096) {
+    const Coords::CartesianArray ga(std::vector<Coords::Cartesian>(s_size, s_g));
+    Coords::CartesianArray next(s_size);
+    for (unsigned long i = 0; i < count; ++i) {
+      next = s_array + s_array*s_dt + ga*(0.5*s_dt*s_dt);
+      doNotOptimize(next.x()[0]);
+    }
+  }
+
+  // x + v*dt + g*dt^2/2, fused expression template
+  COORDS_BENCHMARK(CartesianArray_step_fused_4096) {
+    using namespace Coords::expression;
+    Coords::CartesianArray next(s_size);
+    for (unsigned long i = 0; i < count; ++i) {
+      evaluate(lazy(s_array) + lazy(s_array)*s_dt + lazy(s_g)*(0.5*s_dt*s_dt), next);
+      doNotOptimize(next.x()[0]);
+    }
+  }
+
+  // -----------------------------
+  // ----- rotator, rotation -----
+  // -----------------------------
+
+  COORDS_BENCHMARK(rotator_rotate) {
+    Coords::rotator r(Coords::Cartesian(1, 1, 1));
+    const Coords::angle theta(30);
+    for (unsigned long i = 0; i < count; ++i)
+      doNotOptimize(r.rotate(s_a, theta));
+  }
+
+  // every call a new angle, i.e. trig and a cache miss each time
+  COORDS_BENCHMARK(rotator_rotate_new_angle) {
+    Coords::rotator r(Coords::Cartesian(1, 1, 1));
+    for (unsigned long i = 0; i < count; ++i)
+      doNotOptimize(r.rotate(s_a, Coords::angle(i % 3600 * 0.1)));
+  }
+
+  // cycling through a few fixed angles, cache hits
+  COORDS_BENCHMARK(rotator_rotate_four_angles) {
+    Coords::rotator r(Coords::Cartesian(1, 1, 1));
+    const Coords::angle angles[4] = {Coords::angle(10), Coords::angle(20),
+				     Coords::angle(30), Coords::angle(40)};
+    for (unsigned long i = 0; i < count; ++i)
+      doNotOptimize(r.rotate(s_a, angles[i & 3]));
+  }
+
+  COORDS_BENCHMARK(rotator_rotate_4096) {
+    Coords::rotator r(Coords::Cartesian(1, 1, 1));
+    const Coords::angle theta(30);
+    Coords::CartesianArray result(s_size);
+    for (unsigned long i = 0; i < count; ++i) {
+      r.rotate(s_array, theta, result);
+      doNotOptimize(result.x()[0]);
+    }
+  }
+
+  COORDS_BENCHMARK(rotation_ctor) {
+    Coords::Cartesian axis(1, 1, 1);
+    const Coords::angle theta(30);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(axis);
+      doNotOptimize(Coords::rotation(axis, theta));
+    }
+  }
+
+  COORDS_BENCHMARK(rotation_ctor_cached_angle) {
+    Coords::Cartesian axis(1, 1, 1);
+    const Coords::cachedAngle theta(30);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(axis);
+      doNotOptimize(Coords::rotation(axis, theta));
+    }
+  }
+
+  COORDS_BENCHMARK(rotation_ctor_fast) {
+    Coords::Cartesian axis(1, 1, 1);
+    const Coords::angle theta(30);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(axis);
+      doNotOptimize(Coords::fast::rotationMatrix(axis, theta));
+    }
+  }
+
+  COORDS_BENCHMARK(rotation_compose) {
+    Coords::rotation a(Coords::Cartesian::Ux, Coords::angle(30));
+    Coords::rotation b(Coords::Cartesian::Uz, Coords::angle(-45));
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(a);
+      doNotOptimize(a * b);
+    }
+  }
+
+  // -----------------------------
+  // ----- CartesianRecorder -----
+  // -----------------------------
+
+  COORDS_BENCHMARK(CartesianRecorder_push) {
+    Coords::CartesianRecorder recorder;
+    Coords::Cartesian a(s_a);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(a);
+      recorder.push(a);
+    }
+    doNotOptimize(recorder.get(0));
+  }
+
+} // end anonymous namespace
@@ -27,18 +27,22 @@
 // ================================================================
 
 #include <chrono>
+#include <cstdio>
+#include <fstream>
 #include <random>
 #include <sstream>
+#include <type_traits>
 
 #include <gtest/gtest.h>
 
 #include <angle.h>
 #include <Cartesian.h>
+#include <CartesianRecording.h>
+#include <CartesianStreamRecorder.h>
 #include <spherical.h>
 
 
 // TODO Rotation: more arbitrary rotations, copy and assign operators
-// TODO CartesianRecorder
 
 
 namespace {
@@ -420,6 +424,24 @@ namespace {
     }
   }
 
+  TEST(FixedCartesian, Constexpr) {
+    // evaluated at compile time
+    constexpr Coords::Cartesian a(1, 2, 3);
+    constexpr Coords::Cartesian b(Coords::Cartesian(4, 5, 6) - 2.0*a);
+
+    static_assert(b == Coords::Cartesian(2, 1, 0), "constexpr scale and subtract");
+    static_assert(Coords::dot(a, b) == 4, "constexpr dot");
+    static_assert(a.magnitude2() == 14, "constexpr magnitude2");
+    static_assert(Coords::cross(Coords::Cartesian(1, 0, 0), Coords::Cartesian(0, 1, 0)) ==
+		  Coords::Cartesian(0, 0, 1), "constexpr cross");
+
+    EXPECT_EQ(Coords::Cartesian(2, 1, 0), b);
+  }
+
+  TEST(FixedCartesian, TriviallyCopyable) {
+    EXPECT_TRUE(std::is_trivially_copyable<Coords::Cartesian>::value);
+  }
+
   // ----------------------------
   // ----- Random Cartesian -----
   // ----------------------------
@@ -826,6 +848,138 @@ namespace {
     EXPECT_DOUBLE_EQ(some_point.z(), rotated_point.z());
   }
 
+  // --------------------------------
+  // ----- Rotation cache tests -----
+  // --------------------------------
+
+  TEST(RotationCacheTest, AlternatingAngles) {
+    Coords::rotator about_z(Coords::Cartesian::Uz);
+    Coords::angle a(30);
+    Coords::angle b(-45);
+
+    Coords::Cartesian first(about_z.rotate(Coords::Cartesian::Ux, a));
+    about_z.rotate(Coords::Cartesian::Ux, b);
+
+    for (int i = 0; i < 4; ++i) {
+      EXPECT_EQ(first, about_z.rotate(Coords::Cartesian::Ux, a));
+      about_z.rotate(Coords::Cartesian::Ux, b);
+    }
+
+    EXPECT_EQ(2u, about_z.cacheMisses());
+    EXPECT_EQ(8u, about_z.cacheHits());
+  }
+
+  TEST(RotationCacheTest, AlternatingAxes) {
+    Coords::rotator r(Coords::Cartesian::Ux);
+    Coords::angle an_angle(90);
+
+    r.rotate(Coords::Cartesian::Uy, an_angle);
+    r.axis(Coords::Cartesian::Uy);
+    r.rotate(Coords::Cartesian::Ux, an_angle);
+    r.axis(Coords::Cartesian::Ux);
+
+    Coords::Cartesian s(r.rotate(Coords::Cartesian::Uy, an_angle));
+
+    EXPECT_DOUBLE_EQ(Coords::Cartesian::Uz.x(), s.x());
+    EXPECT_NEAR(Coords::Cartesian::Uz.y(), s.y(), Coords::epsilon);
+    EXPECT_DOUBLE_EQ(Coords::Cartesian::Uz.z(), s.z());
+
+    EXPECT_EQ(2u, r.cacheMisses());
+    EXPECT_EQ(1u, r.cacheHits());
+  }
+
+  TEST(RotationCacheTest, LeastRecentlyUsed) {
+    // one more angle than the cache holds evicts the oldest each time
+    Coords::rotator about_z(Coords::Cartesian::Uz);
+
+    for (int pass = 0; pass < 2; ++pass)
+      for (unsigned int i = 0; i <= Coords::rotator::cache_size; ++i)
+	about_z.rotate(Coords::Cartesian::Ux, Coords::angle(10*i));
+
+    EXPECT_EQ(0u, about_z.cacheHits());
+    EXPECT_EQ(2*(Coords::rotator::cache_size + 1), about_z.cacheMisses());
+
+    // the newest are still cached
+    about_z.rotate(Coords::Cartesian::Ux, Coords::angle(10*Coords::rotator::cache_size));
+    about_z.rotate(Coords::Cartesian::Ux, Coords::angle(10));
+    EXPECT_EQ(2u, about_z.cacheHits());
+  }
+
+  TEST(RotationCacheTest, CachedAngle) {
+    // same matrices from a cachedAngle's sin and cos
+    Coords::rotator about_y(Coords::Cartesian(1, 2, 3));
+    Coords::rotator about_y_cached(Coords::Cartesian(1, 2, 3));
+    Coords::Cartesian a(-1, 0.5, 4);
+
+    for (unsigned int i = 0; i < 3*Coords::rotator::cache_size; ++i) {
+      Coords::cachedAngle theta(11.5*i);
+      EXPECT_EQ(about_y.rotate(a, theta.value()), about_y_cached.rotate(a, theta));
+    }
+
+    EXPECT_EQ(about_y.cacheMisses(), about_y_cached.cacheMisses());
+
+    // one cache for both
+    Coords::cachedAngle theta(23);
+    about_y_cached.rotate(a, theta);
+    about_y_cached.rotate(a, Coords::angle(23));
+    about_y_cached.rotate(a, theta);
+    EXPECT_EQ(2u, about_y_cached.cacheHits());
+  }
+
+  // --------------------------------------
+  // ----- Rotation composition tests -----
+  // --------------------------------------
+
+  TEST(RotationCompositionTest, Identity) {
+    Coords::Cartesian a(1, -2, 3);
+    EXPECT_EQ(a, Coords::rotation().apply(a));
+  }
+
+  TEST(RotationCompositionTest, UxAboutUzThenUxtoUz) {
+    // Ux counter clockwise about Uz to Uy then about Ux to Uz
+
+    Coords::rotation about_z(Coords::Cartesian::Uz, Coords::angle(90));
+    Coords::rotation about_x(Coords::Cartesian::Ux, Coords::angle(90));
+
+    Coords::Cartesian s((about_x * about_z).apply(Coords::Cartesian::Ux));
+
+    EXPECT_NEAR(Coords::Cartesian::Uz.x(), s.x(), Coords::epsilon);
+    EXPECT_NEAR(Coords::Cartesian::Uz.y(), s.y(), Coords::epsilon);
+    EXPECT_DOUBLE_EQ(Coords::Cartesian::Uz.z(), s.z());
+  }
+
+  TEST(RotationCompositionTest, RotatorChain) {
+    Coords::Cartesian axis(1, 2, 3);
+    Coords::Cartesian some_point(-1, 4, 0.5);
+
+    Coords::rotator first(axis);
+    Coords::rotator second(Coords::Cartesian::Uy);
+    Coords::rotator third(Coords::Cartesian(-1, 0, 1));
+
+    Coords::angle a(30), b(-75), c(123);
+
+    Coords::Cartesian chained(third.rotate(second.rotate(first.rotate(some_point, a), b), c));
+
+    Coords::rotation fused(third.matrix(c) * second.matrix(b) * first.matrix(a));
+    Coords::Cartesian composed(fused.apply(some_point));
+
+    const double tolerance(1e-12); // rounding differs between the orders of operation
+
+    EXPECT_NEAR(chained.x(), composed.x(), tolerance);
+    EXPECT_NEAR(chained.y(), composed.y(), tolerance);
+    EXPECT_NEAR(chained.z(), composed.z(), tolerance);
+  }
+
+  TEST(RotationCompositionTest, Inverse) {
+    Coords::rotation r(Coords::Cartesian(1, 1, 1), Coords::angle(40));
+    Coords::Cartesian some_point(-1, -1, 1);
+    Coords::Cartesian back(r.inverse().apply(r.apply(some_point)));
+
+    EXPECT_DOUBLE_EQ(some_point.x(), back.x());
+    EXPECT_DOUBLE_EQ(some_point.y(), back.y());
+    EXPECT_DOUBLE_EQ(some_point.z(), back.z());
+  }
+
   TEST(DISABLED_RotationTest, Diagonal_xyz_180) {
 
     // half circle
@@ -862,6 +1016,257 @@ namespace {
 
 
 
+  // -----------------------------------
+  // ----- CartesianRecorder tests -----
+  // -----------------------------------
+
+  TEST(CartesianRecorderTest, Empty) {
+    Coords::CartesianRecorder r(4);
+    EXPECT_EQ(4u, r.sizeLimit());
+    EXPECT_EQ(0u, r.size());
+    EXPECT_EQ(0u, r.firstSegmentSize());
+    EXPECT_EQ(0u, r.secondSegmentSize());
+  }
+
+  TEST(CartesianRecorderTest, PartialFill) {
+    Coords::CartesianRecorder r(4);
+    r.push(Coords::Cartesian::Uo); // a real point, not a sentinel
+    r.push(Coords::Cartesian(1, 2, 3));
+
+    ASSERT_EQ(2u, r.size());
+    EXPECT_EQ(Coords::Cartesian::Uo, r.get(0));
+    EXPECT_EQ(Coords::Cartesian(1, 2, 3), r.get(1));
+
+    EXPECT_EQ(2u, r.firstSegmentSize());
+    EXPECT_EQ(0u, r.secondSegmentSize());
+    EXPECT_EQ(Coords::Cartesian(1, 2, 3), r.firstSegment()[1]);
+  }
+
+  TEST(CartesianRecorderTest, Wrap) {
+    Coords::CartesianRecorder r(4);
+    for (int i = 0; i < 7; ++i)
+      r.push(Coords::Cartesian(i, 0, 0));
+
+    ASSERT_EQ(4u, r.size());
+    for (unsigned int i = 0; i < r.size(); ++i)
+      EXPECT_EQ(Coords::Cartesian(i + 3, 0, 0), r.get(i));
+
+    // oldest first across the two segments
+    ASSERT_EQ(1u, r.firstSegmentSize());
+    ASSERT_EQ(3u, r.secondSegmentSize());
+    EXPECT_EQ(Coords::Cartesian(3, 0, 0), r.firstSegment()[0]);
+    EXPECT_EQ(Coords::Cartesian(4, 0, 0), r.secondSegment()[0]);
+    EXPECT_EQ(Coords::Cartesian(6, 0, 0), r.secondSegment()[2]);
+
+    r.clear();
+    EXPECT_EQ(0u, r.size());
+  }
+
+  TEST(CartesianRecorderTest, SizeLimit) {
+    Coords::CartesianRecorder r(4);
+    for (int i = 0; i < 6; ++i)
+      r.push(Coords::Cartesian(i, 0, 0));
+
+    r.sizeLimit(2); // keeps the newest
+    ASSERT_EQ(2u, r.size());
+    EXPECT_EQ(Coords::Cartesian(4, 0, 0), r.get(0));
+    EXPECT_EQ(Coords::Cartesian(5, 0, 0), r.get(1));
+
+    r.sizeLimit(3);
+    r.push(Coords::Cartesian(6, 0, 0));
+    r.push(Coords::Cartesian(7, 0, 0));
+    ASSERT_EQ(3u, r.size());
+    EXPECT_EQ(Coords::Cartesian(5, 0, 0), r.get(0));
+    EXPECT_EQ(Coords::Cartesian(7, 0, 0), r.get(2));
+  }
+
+  TEST(CartesianRecorderTest, Copy) {
+    Coords::CartesianRecorder r(3);
+    for (int i = 0; i < 5; ++i)
+      r.push(Coords::Cartesian(i, 0, 0));
+
+    Coords::CartesianRecorder a_copy(r);
+    Coords::CartesianRecorder an_assign;
+    an_assign = r;
+
+    r.push(Coords::Cartesian(5, 0, 0));
+
+    ASSERT_EQ(3u, a_copy.size());
+    EXPECT_EQ(Coords::Cartesian(2, 0, 0), a_copy.get(0));
+    EXPECT_EQ(Coords::Cartesian(2, 0, 0), an_assign.get(0));
+    EXPECT_EQ(Coords::Cartesian(3, 0, 0), r.get(0));
+  }
+
+  TEST(CartesianRecorderTest, Write2R) {
+    const std::string flnm("CartesianRecorderTest_Write2R.dat");
+
+    Coords::CartesianRecorder r(3);
+    r.push(Coords::Cartesian(1, 2, 3));
+    r.push(Coords::Cartesian::Uo);
+
+    r.write2R(flnm);
+
+    std::ifstream result(flnm.c_str());
+    std::string line;
+    std::getline(result, line); // comment
+    std::getline(result, line);
+    EXPECT_EQ("x y z", line);
+    std::getline(result, line);
+    EXPECT_EQ("0 1 2 3", line);
+    std::getline(result, line);
+    EXPECT_EQ("1 0 0 0", line);
+    EXPECT_FALSE(std::getline(result, line));
+
+    std::remove(flnm.c_str());
+  }
+
+  TEST(CartesianRecorderTest, Write2RMatchesOstream) {
+    const std::string flnm("CartesianRecorderTest_Write2RMatchesOstream.dat");
+
+    unsigned int seed(std::chrono::system_clock::now().time_since_epoch().count());
+    std::default_random_engine generator(seed);
+    std::uniform_real_distribution<double> distribution(-1e7, 1e7);
+
+    Coords::CartesianRecorder r(100);
+    std::stringstream expected;
+    expected << "# Formated for R frames <- read.table(" << flnm << ")" << std::endl;
+    expected << "x y z" << std::endl;
+
+    for (unsigned int k = 0; k < r.sizeLimit(); ++k) {
+      Coords::Cartesian a(distribution(generator),
+			  distribution(generator)*1e-12,
+			  k);
+      r.push(a);
+      expected << k << " " << a.x() << " " << a.y() << " " << a.z() << std::endl;
+    }
+
+    r.write2R(flnm);
+
+    std::ifstream result_file(flnm.c_str());
+    std::stringstream result;
+    result << result_file.rdbuf();
+    EXPECT_EQ(expected.str(), result.str());
+
+    std::remove(flnm.c_str());
+  }
+
+  TEST(CartesianRecorderTest, Write2Binary) {
+    const std::string flnm("CartesianRecorderTest_Write2Binary.dat");
+
+    Coords::CartesianRecorder r(5000);
+    for (int i = 0; i < 7000; ++i) // wrapped
+      r.push(Coords::Cartesian(i, -i, 0.5*i));
+
+    r.write2Binary(flnm);
+
+    Coords::CartesianRecording recording(flnm);
+    ASSERT_EQ(r.size(), recording.size());
+    for (unsigned int i = 0; i < r.size(); ++i)
+      EXPECT_EQ(r.get(i), recording.get(i));
+    EXPECT_DOUBLE_EQ(2000, recording.x()[0]);
+    EXPECT_DOUBLE_EQ(-6999, recording.y()[4999]);
+
+    std::remove(flnm.c_str());
+  }
+
+  TEST(CartesianRecorderTest, ReadNotBinary) {
+    const std::string flnm("CartesianRecorderTest_ReadNotBinary.dat");
+
+    Coords::CartesianRecorder r(3);
+    r.push(Coords::Cartesian(1, 2, 3));
+    r.write2R(flnm);
+
+    EXPECT_THROW(Coords::CartesianRecording recording(flnm), Coords::CartesianRecorderIOError);
+    EXPECT_THROW(Coords::CartesianRecording recording("no/such/file.dat"), Coords::CartesianRecorderIOError);
+
+    std::remove(flnm.c_str());
+  }
+
+  TEST(CartesianStreamRecorderTest, MatchesWrite2R) {
+    const std::string flnm("CartesianStreamRecorderTest_MatchesWrite2R.dat");
+
+    const unsigned int n(20000);
+
+    Coords::CartesianRecorder r(n);
+    Coords::CartesianStreamRecorder s(flnm, 16); // small to exercise the waits
+
+    for (unsigned int i = 0; i < n; ++i) {
+      Coords::Cartesian a(i, 1.0/(i + 1), -0.5*i);
+      r.push(a);
+      EXPECT_TRUE(s.push(a));
+    }
+
+    s.close();
+    EXPECT_EQ(n, s.pushed());
+    EXPECT_EQ(n, s.written());
+    EXPECT_EQ(0u, s.dropped());
+
+    std::ifstream result_file(flnm.c_str());
+    std::stringstream result;
+    result << result_file.rdbuf();
+    result_file.close();
+
+    r.write2R(flnm); // same file name for the same header
+
+    std::ifstream expected_file(flnm.c_str());
+    std::stringstream expected;
+    expected << expected_file.rdbuf();
+
+    EXPECT_EQ(expected.str(), result.str());
+
+    std::remove(flnm.c_str());
+  }
+
+  TEST(CartesianStreamRecorderTest, Drop) {
+    const std::string flnm("CartesianStreamRecorderTest_Drop.dat");
+
+    Coords::CartesianStreamRecorder s(flnm, 4, Coords::CartesianStreamRecorder::drop);
+    EXPECT_EQ(4u, s.capacity());
+
+    unsigned long accepted(0);
+    for (unsigned int i = 0; i < 10000; ++i)
+      if (s.push(Coords::Cartesian(i, 0, 0)))
+	++accepted;
+
+    s.close();
+    EXPECT_EQ(accepted, s.pushed());
+    EXPECT_EQ(accepted, s.written());
+    EXPECT_EQ(10000u, accepted + s.dropped());
+    EXPECT_EQ(s.dropped(), s.stalls());
+
+    std::remove(flnm.c_str());
+  }
+
+  TEST(CartesianStreamRecorderTest, PushAfterClose) {
+    const std::string flnm("CartesianStreamRecorderTest_PushAfterClose.dat");
+
+    Coords::CartesianStreamRecorder s(flnm, 4); // waits when full
+    EXPECT_TRUE(s.push(Coords::Cartesian::Ux));
+    s.close();
+
+    // more than the capacity, none may wait for the stopped writer
+    for (unsigned int i = 0; i < 10; ++i)
+      EXPECT_FALSE(s.push(Coords::Cartesian(i, 0, 0)));
+
+    EXPECT_EQ(1u, s.pushed());
+    EXPECT_EQ(1u, s.written());
+    EXPECT_EQ(0u, s.stalls());
+
+    s.close(); // again is harmless
+
+    std::remove(flnm.c_str());
+  }
+
+  TEST(CartesianStreamRecorderTest, BadFile) {
+    EXPECT_THROW(Coords::CartesianStreamRecorder s("no/such/directory/file.dat"),
+		 Coords::CartesianRecorderIOError);
+  }
+
+  TEST(CartesianRecorderTest, Write2RBadFile) {
+    Coords::CartesianRecorder r(3);
+    EXPECT_THROW(r.write2R("no/such/directory/file.dat"), Coords::CartesianRecorderIOError);
+  }
+
 } // end anonymous namespace
 
 
@@ -21,6 +21,8 @@
 //  along with Coordinates. If not, see <http://www.gnu.org/licenses/>.
 // ==================================================================
 
+#include <type_traits>
+
 #include <angle.h>
 #include <utils.h>
 
@@ -70,17 +72,17 @@ Coords::angle::angle(const std::string& a_deg,
 }
 
 
-// copy constructor
-Coords::angle::angle(const Coords::angle& a) {
-  m_degrees = a.degrees();
-}
+// ----- trivially copyable -----
 
-// copy assignment
-Coords::angle& Coords::angle::operator=(const Coords::angle& rhs) {
-  if (this == &rhs) return *this;
-  m_degrees = rhs.degrees();
-  return *this;
-}
+static_assert(std::is_trivially_copyable<Coords::angle>::value &&
+	      std::is_trivially_copyable<Coords::Latitude>::value &&
+	      std::is_trivially_copyable<Coords::Declination>::value,
+	      "angles must stay trivially copyable, no vtable");
+
+static_assert(sizeof(Coords::angle) == sizeof(double) &&
+	      sizeof(Coords::Latitude) == sizeof(double) &&
+	      sizeof(Coords::Declination) == sizeof(double),
+	      "angles must be one double");
 
 // ----- bool operators -----
 
@@ -235,6 +237,31 @@ void Coords::angle::normalize(const double& begin, const double& end) {
   m_degrees = (offset - (floor(offset/width) * width)) + begin;
 }
 
+// ------------------------------------------
+// ----- Latitude and Declination range -----
+// ------------------------------------------
+
+namespace {
+
+  // The error message for a_degrees outside [a_south, a_north] or 0
+  // if it is in range. NaN is in range.
+  const char* rangeError(const double& a_degrees, const double& a_south, const double& a_north) {
+    if (a_degrees > a_north)
+      return "maximum exceeded";
+    if (a_degrees < a_south)
+      return "minimum exceeded";
+    return 0;
+  }
+
+  void checkRange(const double& a_degrees, const double& a_south, const double& a_north) {
+    const char* error(rangeError(a_degrees, a_south, a_north));
+    if (error)
+      throw Coords::Error(error);
+  }
+
+} // end anonymous namespace
+
+
 // ====================
 // ===== Latitude =====
 // ====================
@@ -242,30 +269,24 @@ void Coords::angle::normalize(const double& begin, const double& end) {
 const double Coords::Latitude::g_north_pole(90);
 const double Coords::Latitude::g_south_pole(-90);
 
+bool Coords::Latitude::isValid(const double& a_degrees) {
+  return rangeError(a_degrees, g_south_pole, g_north_pole) == 0;
+}
+
 // ----- constructors -----
 
 Coords::Latitude::Latitude(const double& a_deg,
 			   const double& a_min,
 			   const double& a_sec)
   : angle(a_deg, a_min, a_sec) {
-
-  if (degrees() > g_north_pole)
-    throw Coords::Error("maximum exceeded");
-
-  if (degrees() < g_south_pole)
-    throw Coords::Error("minimum exceeded");
+  checkRange(degrees(), g_south_pole, g_north_pole);
 }
 
 Coords::Latitude::Latitude(const std::string& a_deg,
 			   const std::string& a_min,
 			   const std::string& a_sec)
   : angle(a_deg, a_min, a_sec) {
-
-  if (degrees() > g_north_pole)
-    throw Coords::Error("maximum exceeded");
-
-  if (degrees() < g_south_pole)
-    throw Coords::Error("minimum exceeded");
+  checkRange(degrees(), g_south_pole, g_north_pole);
 }
 
 // =======================
@@ -275,28 +296,33 @@ Coords::Latitude::Latitude(const std::string& a_deg,
 const double Coords::Declination::g_north_pole(90);
 const double Coords::Declination::g_south_pole(-90);
 
+bool Coords::Declination::isValid(const double& a_degrees) {
+  return rangeError(a_degrees, g_south_pole, g_north_pole) == 0;
+}
+
 // ----- constructors -----
 
 Coords::Declination::Declination(const double& a_deg,
 				 const double& a_min,
 				 const double& a_sec)
   : angle(a_deg, a_min, a_sec) {
-
-  if (degrees() > g_north_pole)
-    throw Coords::Error("maximum exceeded");
-
-  if (degrees() < g_south_pole)
-    throw Coords::Error("minimum exceeded");
+  checkRange(degrees(), g_south_pole, g_north_pole);
 }
 
 Coords::Declination::Declination(const std::string& a_deg,
 				 const std::string& a_min,
 				 const std::string& a_sec)
   : angle(a_deg, a_min, a_sec) {
+  checkRange(degrees(), g_south_pole, g_north_pole);
+}
 
-  if (degrees() > g_north_pole)
-    throw Coords::Error("maximum exceeded");
 
-  if (degrees() < g_south_pole)
-    throw Coords::Error("minimum exceeded");
-}
+// =======================
+// ===== cachedAngle =====
+// =======================
+
+const unsigned char Coords::cachedAngle::has_radians;
+const unsigned char Coords::cachedAngle::has_sincos;
+
+static_assert(std::is_trivially_copyable<Coords::cachedAngle>::value,
+	      "cachedAngle must stay trivially copyable");
@@ -61,10 +61,12 @@ namespace Coords {
 		   const std::string& a_min = "0",
 		   const std::string& a_sec = "0");
 
-    virtual ~angle() {};
-
-    angle(const angle& a);
-    angle& operator=(const angle& rhs);
+    // No virtual destructor and compiler generated copy constructor,
+    // copy assignment and destructor keep angle one trivially
+    // copyable double, e.g. for memcpy and the python wrappers'
+    // zero filled memory. Latitude and Declination only add range
+    // checks to the constructors and are never deleted through an
+    // angle pointer.
 
     // ----- accessors -----
     void          degrees(const double& a_degrees) {m_degrees = a_degrees;}
@@ -154,9 +156,9 @@ namespace Coords {
 
   // inline for boost. Use hpp instead?
   inline std::ostream& operator<< (std::ostream& os, const Coords::angle& a) {
-    std::stringstream out;
-    Coords::degrees2HMSString(a.degrees(), out);
-    return os << out.str();
+    char buffer[Coords::angle_string_size];
+    Coords::degrees2HMSString(a.degrees(), buffer);
+    return os << buffer;
   }
 
 
@@ -180,7 +182,10 @@ namespace Coords {
 		      const std::string& a_min = "0.0",
 		      const std::string& a_sec = "0.0");
 
-    virtual ~Latitude() {};
+    // The constructors' range check without the exception, degrees
+    // in [g_south_pole, g_north_pole]. See also toLatitudes() in
+    // angleArray.h for bulk loads.
+    static bool isValid(const double& a_degrees);
 
   };
 
@@ -208,10 +213,89 @@ namespace Coords {
 			 const std::string& a_min = "0.0",
 			 const std::string& a_sec = "0.0");
 
-    virtual ~Declination() {};
+    // The constructors' range check without the exception, degrees
+    // in [g_south_pole, g_north_pole]. See also toDeclinations() in
+    // angleArray.h for bulk loads.
+    static bool isValid(const double& a_degrees);
 
   };
 
 
+  // -----------------------
+  // ----- cachedAngle -----
+  // -----------------------
+
+  // An angle that computes its radians, sine and cosine on first use
+  // and keeps them until the angle is changed, e.g. for the pointing
+  // model angles reused across many conversions and rotations. The
+  // values are the same as angle::radians() and sin(), cos() of it.
+  //
+  // The const accessors fill the cache so, as with the rotator, share
+  // a cachedAngle between threads only after its first use.
+  //
+  // All zeros is a valid zero angle with nothing cached.
+
+  class cachedAngle {
+
+  public:
+
+    explicit cachedAngle(const double& a_deg = 0.0,
+			 const double& a_min = 0.0,
+			 const double& a_sec = 0.0)
+      : m_angle(a_deg, a_min, a_sec), m_radians(0), m_sin(0), m_cos(0), m_cached(0) {}
+
+    explicit cachedAngle(const angle& an_angle)
+      : m_angle(an_angle), m_radians(0), m_sin(0), m_cos(0), m_cached(0) {}
+
+    cachedAngle& operator=(const angle& rhs) {m_angle = rhs; m_cached = 0; return *this;}
+
+    // ----- accessors -----
+
+    const angle&  value() const     {return m_angle;}
+    operator const angle&() const   {return m_angle;}
+
+    void          degrees(const double& a_degrees) {m_angle.degrees(a_degrees); m_cached = 0;}
+    const double& degrees() const                  {return m_angle.degrees();}
+
+    void          radians(const double& a_radians) {m_angle.radians(a_radians); m_cached = 0;}
+    const double& radians() const {
+      if ((m_cached & has_radians) == 0) {
+	m_radians = m_angle.radians();
+	m_cached |= has_radians;
+      }
+      return m_radians;
+    }
+
+    const double& sin() const {
+      if ((m_cached & has_sincos) == 0)
+	sincos();
+      return m_sin;
+    }
+
+    const double& cos() const {
+      if ((m_cached & has_sincos) == 0)
+	sincos();
+      return m_cos;
+    }
+
+  private:
+
+    static const unsigned char has_radians = 1;
+    static const unsigned char has_sincos  = 2;
+
+    void sincos() const {
+      m_sin = std::sin(radians());
+      m_cos = std::cos(radians());
+      m_cached |= has_sincos;
+    }
+
+    angle                 m_angle;
+    mutable double        m_radians;
+    mutable double        m_sin;
+    mutable double        m_cos;
+    mutable unsigned char m_cached; // has_* bits
+
+  };
+
 
 } // end namespace Coords
@@ -0,0 +1,175 @@
+// ==================================================================
+// Filename:    angleArray.cpp
+//
+// Description: Implements the batch angle conversions and normalize.
+//
+//              angle::normalize calls floor, which is a libm call on
+//              x86_64 without SSE4.1 and stops the loop from
+//              vectorizing. floor_kernel below rounds with the 2^52
+//              trick and a compare instead so every loop here is a
+//              straight line of SIMD arithmetic and selects, with no
+//              branches, and gives the same bits as floor. Compiled
+//              with BATCHFLAGS (see the Makefile).
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coordinates is free software: you can redistribute it and/or
+//  modify it under the terms of the GNU General Public License as
+//  published by the Free Software Foundation, either version 3 of the
+//  License, or (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ==================================================================
+
+#include <cmath>
+
+#include <angle.h>
+#include <angleArray.h>
+#include <utils.h>
+
+// -------------------
+// ----- kernels -----
+// -------------------
+
+namespace {
+
+  const double s_two52(4503599627370496.0); // 2^52, all larger doubles are integers
+
+  // Adding and subtracting 2^52 rounds x to the nearest integer, then
+  // step down one if that rounded up. Needs the default rounding mode
+  // and no -ffast-math reassociation. Both sides of each select are
+  // computed so gcc can if-convert with -ftrapping-math.
+  inline double floor_kernel(const double& x) {
+    const double t(x < 0 ? -s_two52 : s_two52);
+    const double r((x + t) - t);
+    const double r_down(r - 1.0);
+    const double f(r > x ? r_down : r);
+    return fabs(x) < s_two52 ? f : x;
+  }
+
+  // same expression as angle::normalize
+  inline double normalize_kernel(const double& deg, const double& begin, const double& width) {
+    const double offset(deg - begin);
+    return (offset - (floor_kernel(offset/width) * width)) + begin;
+  }
+
+  // the angle(double) constructor's round trip through seconds, for
+  // deg2RA and RA2deg
+  inline double seconds_kernel(const double& deg) {
+    return 3600*deg/3600.0;
+  }
+
+  // Latitude::isValid and Declination::isValid without the call,
+  // true for NaN as in the constructors
+  inline bool in_range_kernel(const double& deg, const double& south, const double& north) {
+    return !(deg > north) & !(deg < south);
+  }
+
+  // The range check is a compare per row. The stores are unconditional
+  // and only the count moves on, so a bad row costs no branch.
+  template <class A>
+  unsigned long load_kernel(const double* degrees, A* result, const unsigned long& size,
+			    std::vector<unsigned long>& rejects) {
+    unsigned long count(0);
+    for (unsigned long i = 0; i < size; ++i) {
+      const double deg(seconds_kernel(degrees[i]));
+      result[count].degrees(deg);
+      count += in_range_kernel(deg, A::g_south_pole, A::g_north_pole);
+    }
+    if (count < size) {
+      for (unsigned long i = 0; i < size; ++i)
+	if (!in_range_kernel(seconds_kernel(degrees[i]), A::g_south_pole, A::g_north_pole))
+	  rejects.push_back(i);
+    }
+    return count;
+  }
+
+  template <class A>
+  unsigned long load_kernel(const double* degrees, const double* minutes, const double* seconds,
+			    A* result, const unsigned long& size,
+			    std::vector<unsigned long>& rejects) {
+    unsigned long count(0);
+    for (unsigned long i = 0; i < size; ++i) {
+      const double deg(Coords::degrees2seconds(degrees[i], minutes[i], seconds[i])/3600.0);
+      result[count].degrees(deg);
+      if (in_range_kernel(deg, A::g_south_pole, A::g_north_pole))
+	++count;
+      else
+	rejects.push_back(i);
+    }
+    return count;
+  }
+
+} // end anonymous namespace
+
+
+// -----------------------------
+// ----- batch conversions -----
+// -----------------------------
+
+void Coords::deg2rad(const double* degrees, double* result, const unsigned long& size) {
+  for (unsigned long i = 0; i < size; ++i)
+    result[i] = degrees[i]*M_PI/180.0;
+}
+
+void Coords::rad2deg(const double* radians, double* result, const unsigned long& size) {
+  for (unsigned long i = 0; i < size; ++i)
+    result[i] = radians[i]*180.0/M_PI;
+}
+
+void Coords::deg2RA(const double* degrees, double* result, const unsigned long& size) {
+  for (unsigned long i = 0; i < size; ++i) {
+    const double deg(normalize_kernel(seconds_kernel(degrees[i]), -180, 360));
+    const double hours(deg/15.0);
+    const double hours_24(24.0 + hours);
+    result[i] = deg < 0 ? hours_24 : hours;
+  }
+}
+
+void Coords::RA2deg(const double* hours, double* result, const unsigned long& size) {
+  for (unsigned long i = 0; i < size; ++i)
+    result[i] = normalize_kernel(seconds_kernel(hours[i]*15.0), -180, 360);
+}
+
+void Coords::normalize(const double* degrees, double* result, const unsigned long& size,
+		       const double& begin, const double& end) {
+  const double first(begin); // not through a reference that may alias result
+  const double width(end - begin);
+  for (unsigned long i = 0; i < size; ++i)
+    result[i] = normalize_kernel(degrees[i], first, width);
+}
+
+
+// ----------------------------------------------
+// ----- Latitude and Declination bulk loads -----
+// ----------------------------------------------
+
+unsigned long Coords::toLatitudes(const double* degrees, Latitude* result, const unsigned long& size,
+				  std::vector<unsigned long>& rejects) {
+  return load_kernel(degrees, result, size, rejects);
+}
+
+unsigned long Coords::toLatitudes(const double* degrees, const double* minutes, const double* seconds,
+				  Latitude* result, const unsigned long& size,
+				  std::vector<unsigned long>& rejects) {
+  return load_kernel(degrees, minutes, seconds, result, size, rejects);
+}
+
+unsigned long Coords::toDeclinations(const double* degrees, Declination* result, const unsigned long& size,
+				     std::vector<unsigned long>& rejects) {
+  return load_kernel(degrees, result, size, rejects);
+}
+
+unsigned long Coords::toDeclinations(const double* degrees, const double* minutes, const double* seconds,
+				     Declination* result, const unsigned long& size,
+				     std::vector<unsigned long>& rejects) {
+  return load_kernel(degrees, minutes, seconds, result, size, rejects);
+}
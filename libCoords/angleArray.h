@@ -0,0 +1,81 @@
+// ================================================================
+// Filename:    angleArray.h
+//
+// Description: This defines batch versions of the angle unit
+//              conversions and normalize over contiguous arrays of
+//              angles, e.g. a column of hour angles or the theta and
+//              phi columns of a sphericalArray. Each result is the
+//              same as the scalar angle method applied to each
+//              element.
+//
+//              The result may be the input array.
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coords is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coords is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coords.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#pragma once
+
+#include <vector>
+
+namespace Coords {
+
+  class Latitude;
+  class Declination;
+
+  // -----------------------------
+  // ----- batch conversions -----
+  // -----------------------------
+
+  // angle::deg2rad and angle::rad2deg
+  void deg2rad(const double* degrees, double* result, const unsigned long& size);
+  void rad2deg(const double* radians, double* result, const unsigned long& size);
+
+  // angle::deg2RA and angle::RA2deg, Right Ascension in hours
+  void deg2RA(const double* degrees, double* result, const unsigned long& size);
+  void RA2deg(const double* hours, double* result, const unsigned long& size);
+
+  // angle::normalize, to [begin, end)
+  void normalize(const double* degrees, double* result, const unsigned long& size,
+		 const double& begin=0.0, const double& end=360);
+
+  // ----------------------------------------------
+  // ----- Latitude and Declination bulk loads -----
+  // ----------------------------------------------
+
+  // The constructors without the exceptions, for loading catalogs
+  // with bad rows. Each row in range is constructed into the next
+  // element of result, in order, and the index of each row out of
+  // range is appended to rejects. NaN is in range, as it is for the
+  // constructors. Returns the number of rows written to result,
+  // which must hold size elements.
+
+  unsigned long toLatitudes(const double* degrees, Latitude* result, const unsigned long& size,
+			    std::vector<unsigned long>& rejects);
+
+  unsigned long toLatitudes(const double* degrees, const double* minutes, const double* seconds,
+			    Latitude* result, const unsigned long& size,
+			    std::vector<unsigned long>& rejects);
+
+  unsigned long toDeclinations(const double* degrees, Declination* result, const unsigned long& size,
+			       std::vector<unsigned long>& rejects);
+
+  unsigned long toDeclinations(const double* degrees, const double* minutes, const double* seconds,
+			       Declination* result, const unsigned long& size,
+			       std::vector<unsigned long>& rejects);
+
+} // end namespace Coords
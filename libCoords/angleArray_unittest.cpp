@@ -0,0 +1,267 @@
+// ================================================================
+// Filename:    angleArray_unittest.cpp
+// Description: This is the gtest unittest of the batch angle
+//              conversions and normalize. Each result is checked
+//              against the scalar angle method, bit for bit.
+//
+// Author:      L.R. McFarland, lrm@starbug.com
+// Created:     2026 Oct 16
+// Language:    C++
+//
+// See also: http://code.google.com/p/googletest/wiki/Primer
+//
+//  Coordinates is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#include <chrono>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <angle.h>
+#include <angleArray.h>
+
+
+namespace {
+
+  // edge cases for the floor in normalize: range ends, zeros,
+  // fractions either side of zero and past 2^52
+  std::vector<double> edges() {
+    const double a[] = {0.0, -0.0, 360, -360, 180, -180, 720.5, -720.5,
+			0.25, -0.25, 359.999999999, -1e-300, 1e-300,
+			4503599627370495.5, -4503599627370495.5,
+			4503599627370496.0, 9007199254740993.0, -1e17, 1e300};
+    return std::vector<double>(a, a + sizeof(a)/sizeof(a[0]));
+  }
+
+  // ----------------------------
+  // ----- Fixed angleArray -----
+  // ----------------------------
+
+  TEST(FixedAngleArray, Normalize) {
+    const std::vector<double> a(edges());
+    std::vector<double> result(a.size());
+
+    Coords::normalize(a.data(), result.data(), a.size());
+
+    for (unsigned long i = 0; i < a.size(); ++i) {
+      Coords::angle expected;
+      expected.degrees(a[i]);
+      expected.normalize();
+      EXPECT_EQ(expected.degrees(), result[i]) << "degrees " << a[i];
+    }
+  }
+
+  TEST(FixedAngleArray, NormalizeRange) {
+    const std::vector<double> a(edges());
+    std::vector<double> result(a.size());
+
+    Coords::normalize(a.data(), result.data(), a.size(), -180, 180);
+
+    for (unsigned long i = 0; i < a.size(); ++i) {
+      Coords::angle expected;
+      expected.degrees(a[i]);
+      expected.normalize(-180, 180);
+      EXPECT_EQ(expected.degrees(), result[i]) << "degrees " << a[i];
+    }
+  }
+
+  TEST(FixedAngleArray, Deg2RA) {
+    const std::vector<double> a(edges());
+    std::vector<double> result(a.size());
+
+    Coords::deg2RA(a.data(), result.data(), a.size());
+
+    for (unsigned long i = 0; i < a.size(); ++i)
+      EXPECT_EQ(Coords::angle::deg2RA(a[i]), result[i]) << "degrees " << a[i];
+  }
+
+  TEST(FixedAngleArray, RA2Deg) {
+    const double a[] = {0, 6, 12, 18, 24, -6, 23.999999, 36.5};
+    const unsigned long n(sizeof(a)/sizeof(a[0]));
+    double result[n];
+
+    Coords::RA2deg(a, result, n);
+
+    for (unsigned long i = 0; i < n; ++i)
+      EXPECT_EQ(Coords::angle::RA2deg(a[i]), result[i]) << "hours " << a[i];
+  }
+
+  TEST(FixedAngleArray, Empty) {
+    Coords::normalize(0, 0, 0);
+    Coords::deg2rad(0, 0, 0);
+  }
+
+  TEST(FixedAngleArray, ToLatitudes) {
+    const double a[] = {0, 90, -90, 90.0001, -90.0001, 45.5, 1e300, -0.0,
+			std::numeric_limits<double>::quiet_NaN(), -12.25};
+    const unsigned long n(sizeof(a)/sizeof(a[0]));
+    Coords::Latitude result[n];
+    std::vector<unsigned long> rejects;
+
+    EXPECT_EQ(7, Coords::toLatitudes(a, result, n, rejects));
+
+    ASSERT_EQ(3, rejects.size());
+    EXPECT_EQ(3, rejects[0]);
+    EXPECT_EQ(4, rejects[1]);
+    EXPECT_EQ(6, rejects[2]);
+
+    EXPECT_EQ(Coords::Latitude(-90).degrees(), result[2].degrees());
+    EXPECT_EQ(Coords::Latitude(45.5).degrees(), result[3].degrees());
+    EXPECT_TRUE(std::isnan(result[5].degrees()));
+    EXPECT_EQ(Coords::Latitude(-12.25).degrees(), result[6].degrees());
+  }
+
+  TEST(FixedAngleArray, ToDeclinationsDMS) {
+    const double d[] = {89, 90, -89, 0, -90};
+    const double m[] = {59, 0, 60, -30, 0};
+    const double s[] = {60, 0.1, 0.1, 15, 0};
+    const unsigned long n(sizeof(d)/sizeof(d[0]));
+    Coords::Declination result[n];
+    std::vector<unsigned long> rejects;
+
+    EXPECT_EQ(3, Coords::toDeclinations(d, m, s, result, n, rejects));
+
+    ASSERT_EQ(2, rejects.size());
+    EXPECT_EQ(1, rejects[0]);
+    EXPECT_EQ(2, rejects[1]);
+
+    EXPECT_EQ(Coords::Declination(89, 59, 60).degrees(), result[0].degrees());
+    EXPECT_EQ(Coords::Declination(0, -30, 15).degrees(), result[1].degrees());
+    EXPECT_EQ(Coords::Declination(-90).degrees(), result[2].degrees());
+  }
+
+  TEST(FixedAngleArray, ToLatitudesAppends) {
+    const double a[] = {100, 10};
+    Coords::Latitude result[2];
+    std::vector<unsigned long> rejects(1, 42);
+
+    EXPECT_EQ(1, Coords::toLatitudes(a, result, 2, rejects));
+
+    ASSERT_EQ(2, rejects.size());
+    EXPECT_EQ(42, rejects[0]);
+    EXPECT_EQ(0, rejects[1]);
+    EXPECT_EQ(10, result[0].degrees());
+  }
+
+  // -----------------------------
+  // ----- Random angleArray -----
+  // -----------------------------
+
+  class RandomAngleArray : public ::testing::Test {
+    // Creates new random angles each test.
+  protected:
+
+    virtual void SetUp() {
+
+      seed = std::chrono::system_clock::now().time_since_epoch().count();
+      lo = -1e4;
+      hi = 1e4;
+      size = 1027; // not a multiple of the vector width
+
+      std::default_random_engine generator(seed);
+      std::uniform_real_distribution<double> distribution(lo, hi);
+
+      for (unsigned long i = 0; i < size; ++i)
+	degrees.push_back(distribution(generator));
+    }
+
+    virtual void TearDown() {}
+
+    // members
+
+    unsigned int seed;
+    double lo;
+    double hi;
+    unsigned long size;
+
+    std::vector<double> degrees;
+
+  };
+
+  TEST_F(RandomAngleArray, Deg2Rad2Deg) {
+    std::vector<double> radians(size), result(size);
+
+    Coords::deg2rad(degrees.data(), radians.data(), size);
+    Coords::rad2deg(radians.data(), result.data(), size);
+
+    for (unsigned long i = 0; i < size; ++i) {
+      EXPECT_EQ(Coords::angle::deg2rad(degrees[i]), radians[i]);
+      EXPECT_EQ(Coords::angle::rad2deg(radians[i]), result[i]);
+    }
+  }
+
+  TEST_F(RandomAngleArray, NormalizeInplace) {
+    std::vector<double> result(degrees);
+
+    Coords::normalize(result.data(), result.data(), size, -90, 270);
+
+    for (unsigned long i = 0; i < size; ++i) {
+      Coords::angle expected;
+      expected.degrees(degrees[i]);
+      expected.normalize(-90, 270);
+      EXPECT_EQ(expected.degrees(), result[i]) << "seed " << seed;
+    }
+  }
+
+  TEST_F(RandomAngleArray, RoundTripRA) {
+    std::vector<double> hours(size), result(size);
+
+    Coords::deg2RA(degrees.data(), hours.data(), size);
+    Coords::RA2deg(hours.data(), result.data(), size);
+
+    for (unsigned long i = 0; i < size; ++i) {
+      EXPECT_EQ(Coords::angle::deg2RA(degrees[i]), hours[i]) << "seed " << seed;
+      EXPECT_EQ(Coords::angle::RA2deg(hours[i]), result[i]) << "seed " << seed;
+    }
+  }
+
+  // each row against the throwing constructor
+  TEST_F(RandomAngleArray, ToDeclinations) {
+    std::vector<double> scaled(size);
+    for (unsigned long i = 0; i < size; ++i)
+      scaled[i] = degrees[i]/50; // about 1 in 100 in range
+    std::vector<Coords::Declination> result(size);
+    std::vector<unsigned long> rejects;
+
+    const unsigned long count(Coords::toDeclinations(scaled.data(), result.data(), size, rejects));
+
+    EXPECT_EQ(size, count + rejects.size()) << "seed " << seed;
+
+    unsigned long j(0), k(0);
+    for (unsigned long i = 0; i < size; ++i) {
+      try {
+	Coords::Declination expected(scaled[i]);
+	ASSERT_LT(j, count) << "seed " << seed;
+	EXPECT_EQ(expected.degrees(), result[j++].degrees()) << "seed " << seed;
+      } catch (Coords::Error& err) {
+	ASSERT_LT(k, rejects.size()) << "seed " << seed;
+	EXPECT_EQ(i, rejects[k++]) << "seed " << seed;
+      }
+    }
+  }
+
+} // end anonymous namespace
+
+
+// ==================
+// ===== main() =====
+// ==================
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
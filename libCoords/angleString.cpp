@@ -0,0 +1,157 @@
+// ==================================================================
+// Filename:    angleString.cpp
+//
+// Description: Implements the sexagesimal angle parser.
+//
+//              Each field is read with the Clinger fast path, an
+//              integer mantissa of up to 19 digits times or divided
+//              by an exact power of ten, which is one rounding and so
+//              the same as strtod. Fields outside it, mantissas past
+//              2^53 or powers past 10^22, are copied to a buffer on
+//              the stack and given to strtod.
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coordinates is free software: you can redistribute it and/or
+//  modify it under the terms of the GNU General Public License as
+//  published by the Free Software Foundation, either version 3 of the
+//  License, or (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ==================================================================
+
+#include <cstring>
+#include <limits>
+
+#include <angleString.h>
+#include <utils.h>
+
+// -------------------
+// ----- scanner -----
+// -------------------
+
+namespace {
+
+  inline void skipSpace(const char*& p, const char* end) {
+    while (p < end && Coords::isSpace(*p))
+      ++p;
+  }
+
+  // The UTF-8 degree sign is two bytes
+  inline bool isDegreeSign(const char* p, const char* end) {
+    return end - p >= 2 && p[0] == '\xc2' && p[1] == '\xb0';
+  }
+
+  // Moves p past the separator ending field, if any. Returns true if
+  // another field may follow.
+  bool parseSeparator(const char*& p, const char* end, const int& field, bool& isHours) {
+
+    skipSpace(p, end);
+
+    if (p == end)
+      return false;
+
+    const char c(*p);
+
+    if (c == ':' && field < 2) {
+      ++p;
+    } else if (field == 0 && (c == 'd' || c == 'D' || c == '*')) {
+      ++p;
+    } else if (field == 0 && (c == 'h' || c == 'H')) {
+      ++p;
+      isHours = true;
+    } else if (field == 0 && isDegreeSign(p, end)) {
+      p += 2;
+    } else if (field == 1 && (c == 'm' || c == 'M' || c == '\'')) {
+      ++p;
+    } else if (field == 2 && (c == 's' || c == 'S' || c == '"')) {
+      ++p;
+    }
+
+    skipSpace(p, end);
+
+    return field < 2 && p < end;
+  }
+
+} // end anonymous namespace
+
+
+// -------------------------------
+// ----- sexagesimal parsing -----
+// -------------------------------
+
+bool Coords::parseSexagesimal(const char* a_begin, const char* a_end,
+			      double& a_value, bool& a_isHours) {
+
+  const char* p(a_begin);
+  skipSpace(p, a_end);
+
+  bool isNegative(false);
+  if (p < a_end && (*p == '-' || *p == '+')) {
+    isNegative = *p == '-';
+    ++p;
+  }
+
+  double fields[3] = {0, 0, 0};
+  bool isHours(false);
+
+  for (int field = 0; field < 3; ++field) {
+    if (!Coords::parseDecimal(p, a_end, fields[field], false))
+      return false;
+    if (!parseSeparator(p, a_end, field, isHours))
+      break;
+  }
+
+  if (p != a_end)
+    return false;
+
+  // the angle constructors' arithmetic, negated once at the end
+  const double value(Coords::degrees2seconds(fields[0], fields[1], fields[2])/3600.0);
+
+  a_value = isNegative ? -value : value;
+  a_isHours = isHours;
+
+  return true;
+}
+
+bool Coords::parseSexagesimal(const char* a_begin, const char* a_end, double& a_value) {
+  bool isHours;
+  return parseSexagesimal(a_begin, a_end, a_value, isHours);
+}
+
+bool Coords::parseSexagesimal(const std::string& a_string, double& a_value) {
+  return parseSexagesimal(a_string.data(), a_string.data() + a_string.size(), a_value);
+}
+
+unsigned long Coords::parseSexagesimal(const char* a_begin, const char* a_end,
+				       double* a_result, const unsigned long& a_size,
+				       std::vector<unsigned long>& a_rejects,
+				       const char& a_separator) {
+  unsigned long row(0);
+  const char* p(a_begin);
+
+  while (p < a_end && row < a_size) {
+
+    const char* eol(static_cast<const char*>(memchr(p, a_separator, a_end - p)));
+    if (!eol)
+      eol = a_end;
+
+    if (!parseSexagesimal(p, eol, a_result[row])) {
+      a_result[row] = std::numeric_limits<double>::quiet_NaN();
+      a_rejects.push_back(row);
+    }
+
+    ++row;
+    p = eol + (eol < a_end);
+  }
+
+  return row;
+}
@@ -0,0 +1,80 @@
+// ================================================================
+// Filename:    angleString.h
+//
+// Description: This defines a parser for angles written as one
+//              sexagesimal string, e.g. "-12:34:56.78",
+//              "12h34m56.7s" or "-12* 34' 56.78\"", for catalog
+//              ingest. It reads char ranges in place, so a field
+//              does not need to be split out, copied into a
+//              std::string or NUL terminated first. It does not
+//              allocate or throw.
+//
+//              The grammar is an optional sign and one to three
+//              unsigned decimal fields, degrees (or hours), minutes
+//              and seconds. A field ends with a separator, one of
+//
+//                degrees: ':', 'd', 'D', '*', the UTF-8 degree sign
+//                         or 'h', 'H' for hours
+//                minutes: ':', 'm', 'M', '\''
+//                seconds: 's', 'S', '"'
+//
+//              or white space. Leading and trailing white space is
+//              ignored. There are no exponents.
+//
+//              The sign applies to the whole angle, so "-00:30:00"
+//              is -0.5. Otherwise the value is the same, bit for bit,
+//              as the angle string constructor given the three
+//              fields, i.e. degrees2seconds(deg, min, sec)/3600.
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coords is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coords is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coords.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace Coords {
+
+  // -------------------------------
+  // ----- sexagesimal parsing -----
+  // -------------------------------
+
+  // Parses all of [a_begin, a_end) into a_value, in the units of the
+  // first field. a_isHours is set if that field ended in 'h', e.g.
+  // for angle::RA2deg. Returns false, and leaves a_value and
+  // a_isHours unchanged, if the range is not one angle.
+  bool parseSexagesimal(const char* a_begin, const char* a_end,
+			double& a_value, bool& a_isHours);
+
+  bool parseSexagesimal(const char* a_begin, const char* a_end, double& a_value);
+
+  bool parseSexagesimal(const std::string& a_string, double& a_value);
+
+  // Parses a column of angles, one per row, with rows ending in
+  // a_separator, e.g. a text file's worth of lines read into one
+  // buffer. The separator after the last row is optional. Each row
+  // is parsed into the next element of a_result, at most a_size of
+  // them. A row that is not an angle is NaN in a_result and its
+  // index is appended to a_rejects. Returns the number of rows.
+  unsigned long parseSexagesimal(const char* a_begin, const char* a_end,
+				 double* a_result, const unsigned long& a_size,
+				 std::vector<unsigned long>& a_rejects,
+				 const char& a_separator='\n');
+
+} // end namespace Coords
@@ -0,0 +1,236 @@
+// ================================================================
+// Filename:    angleString_unittest.cpp
+// Description: This is the gtest unittest of the sexagesimal angle
+//              parser. Values are checked against the angle string
+//              constructor given the same fields, bit for bit.
+//
+// Author:      L.R. McFarland, lrm@starbug.com
+// Created:     2026 Oct 16
+// Language:    C++
+//
+// See also: http://code.google.com/p/googletest/wiki/Primer
+//
+//  Coordinates is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <angle.h>
+#include <angleString.h>
+
+
+namespace {
+
+  double parse(const std::string& a_string) {
+    double value(-999);
+    EXPECT_TRUE(Coords::parseSexagesimal(a_string, value)) << a_string;
+    return value;
+  }
+
+  // ----------------------------------
+  // ----- Fixed parseSexagesimal -----
+  // ----------------------------------
+
+  TEST(FixedParseSexagesimal, Colons) {
+    EXPECT_EQ(Coords::angle("-12", "34", "56.78").degrees(), parse("-12:34:56.78"));
+    EXPECT_EQ(Coords::angle("12", "34", "56.78").degrees(), parse("+12:34:56.78"));
+    EXPECT_EQ(Coords::angle("12", "34").degrees(), parse("12:34"));
+  }
+
+  TEST(FixedParseSexagesimal, Decimal) {
+    EXPECT_EQ(Coords::angle("-12.5").degrees(), parse("-12.5"));
+    EXPECT_EQ(Coords::angle("0.25").degrees(), parse(".25"));
+    EXPECT_EQ(Coords::angle("7").degrees(), parse("7."));
+  }
+
+  TEST(FixedParseSexagesimal, Hours) {
+    double value;
+    bool isHours(false);
+    const std::string s("12h34m56.7s");
+
+    EXPECT_TRUE(Coords::parseSexagesimal(s.data(), s.data() + s.size(), value, isHours));
+    EXPECT_TRUE(isHours);
+    EXPECT_EQ(Coords::angle("12", "34", "56.7").degrees(), value);
+  }
+
+  TEST(FixedParseSexagesimal, NotHours) {
+    double value;
+    bool isHours(true);
+    const std::string s("12d34m56.7s");
+
+    EXPECT_TRUE(Coords::parseSexagesimal(s.data(), s.data() + s.size(), value, isHours));
+    EXPECT_FALSE(isHours);
+  }
+
+  TEST(FixedParseSexagesimal, Separators) {
+    const double expected(Coords::angle("-12", "34", "56.78").degrees());
+    EXPECT_EQ(expected, parse("-12 34 56.78"));
+    EXPECT_EQ(expected, parse("  -12d 34m 56.78s \r"));
+    EXPECT_EQ(expected, parse("-12* 34' 56.78\""));
+    EXPECT_EQ(expected, parse("-12\xc2\xb0" "34'56.78\""));
+  }
+
+  TEST(FixedParseSexagesimal, DegreesToDMSString) {
+    std::stringstream out;
+    Coords::degrees2DMSString(-12.5825, out);
+    EXPECT_NEAR(-12.5825, parse(out.str()), 1e-12) << out.str();
+  }
+
+  TEST(FixedParseSexagesimal, NegativeZeroDegrees) {
+    // the sign is the whole angle's
+    EXPECT_EQ(-0.5, parse("-00:30:00"));
+    EXPECT_EQ(-1.0/3600, parse("-0 0 1"));
+  }
+
+  TEST(FixedParseSexagesimal, LongFields) {
+    EXPECT_EQ(Coords::angle("1", "2", "3.00000000000000000000001").degrees(),
+	      parse("1:2:3.00000000000000000000001"));
+    EXPECT_EQ(Coords::angle("123456789012345678901234").degrees(),
+	      parse("123456789012345678901234"));
+  }
+
+  TEST(FixedParseSexagesimal, NotAngles) {
+    const char* bad[] = {"", " ", "-", "+-1", "12:-34", "1:2:3:4", "12x", ".",
+			 "12h34h", "1e5", "12:34:56s7",
+			 "1.00000000000000000000000000000000000000000000000000000000000000001"};
+    for (unsigned long i = 0; i < sizeof(bad)/sizeof(bad[0]); ++i) {
+      double value(42);
+      EXPECT_FALSE(Coords::parseSexagesimal(bad[i], value)) << "'" << bad[i] << "'";
+      EXPECT_EQ(42, value);
+    }
+  }
+
+  TEST(FixedParseSexagesimal, RangeIsNotTerminated) {
+    const char buffer[] = "12:30:007"; // the range stops before the 7
+    double value;
+    EXPECT_TRUE(Coords::parseSexagesimal(buffer, buffer + 8, value));
+    EXPECT_EQ(12.5, value);
+  }
+
+  TEST(FixedParseSexagesimal, Column) {
+    const std::string column("-12:34:56.78\n"
+			     "bad\n"
+			     "01:02:03\r\n"
+			     "\n"
+			     "45.5");
+    double result[8];
+    std::vector<unsigned long> rejects;
+
+    EXPECT_EQ(5, Coords::parseSexagesimal(column.data(), column.data() + column.size(),
+					  result, 8, rejects));
+
+    EXPECT_EQ(parse("-12:34:56.78"), result[0]);
+    EXPECT_TRUE(std::isnan(result[1]));
+    EXPECT_EQ(parse("1:2:3"), result[2]);
+    EXPECT_TRUE(std::isnan(result[3]));
+    EXPECT_EQ(45.5, result[4]);
+
+    ASSERT_EQ(2, rejects.size());
+    EXPECT_EQ(1, rejects[0]);
+    EXPECT_EQ(3, rejects[1]);
+  }
+
+  TEST(FixedParseSexagesimal, ColumnSize) {
+    const std::string column("1,2,3,");
+    double result[2];
+    std::vector<unsigned long> rejects;
+
+    EXPECT_EQ(2, Coords::parseSexagesimal(column.data(), column.data() + column.size(),
+					  result, 2, rejects, ','));
+    EXPECT_EQ(1, result[0]);
+    EXPECT_EQ(2, result[1]);
+    EXPECT_TRUE(rejects.empty());
+  }
+
+  // -----------------------------------
+  // ----- Random parseSexagesimal -----
+  // -----------------------------------
+
+  class RandomParseSexagesimal : public ::testing::Test {
+    // Creates new random angles each test.
+  protected:
+
+    virtual void SetUp() {
+      seed = std::chrono::system_clock::now().time_since_epoch().count();
+      generator.seed(seed);
+    }
+
+    virtual void TearDown() {}
+
+    // members
+
+    unsigned int seed;
+    std::default_random_engine generator;
+
+  };
+
+  TEST_F(RandomParseSexagesimal, SameAsAngle) {
+    std::uniform_int_distribution<int> degrees(-359, 359);
+    std::uniform_int_distribution<int> minutes(0, 59);
+    std::uniform_real_distribution<double> seconds(0, 60);
+    std::uniform_int_distribution<int> precision(0, 17);
+
+    for (int i = 0; i < 10000; ++i) {
+      char d[32], m[32], s[32], dms[96];
+      snprintf(d, sizeof(d), "%d", degrees(generator));
+      snprintf(m, sizeof(m), "%02d", minutes(generator));
+      snprintf(s, sizeof(s), "%.*f", precision(generator), seconds(generator));
+      snprintf(dms, sizeof(dms), "%s:%s:%s", d, m, s);
+
+      EXPECT_EQ(Coords::angle(d, m, s).degrees(), parse(dms)) << dms << " seed " << seed;
+    }
+  }
+
+  TEST_F(RandomParseSexagesimal, Column) {
+    std::uniform_real_distribution<double> distribution(-90, 90);
+    const unsigned long size(1027);
+    std::vector<double> expected(size);
+    std::string column;
+
+    for (unsigned long i = 0; i < size; ++i) {
+      char row[32];
+      snprintf(row, sizeof(row), "%.9f\n", distribution(generator));
+      expected[i] = Coords::angle(row).degrees();
+      column += row;
+    }
+
+    std::vector<double> result(size);
+    std::vector<unsigned long> rejects;
+
+    EXPECT_EQ(size, Coords::parseSexagesimal(column.data(), column.data() + column.size(),
+					     result.data(), size, rejects));
+    EXPECT_TRUE(rejects.empty());
+
+    for (unsigned long i = 0; i < size; ++i)
+      EXPECT_EQ(expected[i], result[i]) << "seed " << seed;
+  }
+
+} // end anonymous namespace
+
+
+// ==================
+// ===== main() =====
+// ==================
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
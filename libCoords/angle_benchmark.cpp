@@ -0,0 +1,318 @@
+// ================================================================
+// Filename:    angle_benchmark.cpp
+// Description: Benchmarks of angle construction, conversion,
+//              normalization and formatting.
+//
+//              Array benchmarks are per call over s_size angles.
+//
+// Author:      L.R. McFarland, lrm@starbug.com
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coordinates is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <angle.h>
+#include <angleArray.h>
+#include <angleString.h>
+#include <benchmark.h>
+#include <utils.h>
+
+namespace {
+
+  using Coords::benchmark::doNotOptimize;
+
+  // ----------------
+  // ----- data -----
+  // ----------------
+
+  const unsigned long s_size(4096);
+
+  std::vector<double> hour_angles() {
+    std::vector<double> a(s_size);
+    for (unsigned long i = 0; i < s_size; ++i)
+      a[i] = i * 0.37 - 700;
+    return a;
+  }
+
+  const std::vector<double> s_degrees(hour_angles());
+
+  // -----------------
+  // ----- angle -----
+  // -----------------
+
+  COORDS_BENCHMARK(angle_dms_ctor) {
+    double d(12), m(34), s(56.7);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(d);
+      doNotOptimize(Coords::angle(d, m, s));
+    }
+  }
+
+  COORDS_BENCHMARK(angle_string_ctor) {
+    const std::string d("-12"), m("34"), s("56.7");
+    for (unsigned long i = 0; i < count; ++i)
+      doNotOptimize(Coords::angle(d, m, s));
+  }
+
+  COORDS_BENCHMARK(angle_radians) {
+    Coords::angle a(123.456);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(a);
+      doNotOptimize(a.radians());
+    }
+  }
+
+  COORDS_BENCHMARK(angle_RA) {
+    Coords::angle a(-123.456);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(a);
+      doNotOptimize(a.RA());
+    }
+  }
+
+  COORDS_BENCHMARK(angle_normalize) {
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::angle a(i % 7200 - 3600.5);
+      a.normalize();
+      doNotOptimize(a);
+    }
+  }
+
+  COORDS_BENCHMARK(angle_add) {
+    Coords::angle a(10), b(20.5);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(a);
+      doNotOptimize(a + b);
+    }
+  }
+
+  COORDS_BENCHMARK(angle_sin_cos) {
+    Coords::angle a(123.456);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(a);
+      doNotOptimize(sin(a.radians()) + cos(a.radians()));
+    }
+  }
+
+  COORDS_BENCHMARK(cachedAngle_sin_cos) {
+    const Coords::cachedAngle a(123.456);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(a);
+      doNotOptimize(a.sin() + a.cos());
+    }
+  }
+
+  COORDS_BENCHMARK(Latitude_ctor) {
+    double d(45.5);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(d);
+      doNotOptimize(Coords::Latitude(d));
+    }
+  }
+
+  // ----------------------
+  // ----- angleArray -----
+  // ----------------------
+
+  // the scalar loop the batch normalize replaces
+  COORDS_BENCHMARK(angle_normalize_loop_4096) {
+    std::vector<double> result(s_size);
+    for (unsigned long i = 0; i < count; ++i) {
+      for (unsigned long j = 0; j < s_size; ++j) {
+	Coords::angle a;
+	a.degrees(s_degrees[j]);
+	a.normalize(-180, 180);
+	result[j] = a.degrees();
+      }
+      doNotOptimize(result[0]);
+    }
+  }
+
+  COORDS_BENCHMARK(angleArray_normalize_4096) {
+    std::vector<double> result(s_size);
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::normalize(s_degrees.data(), result.data(), s_size, -180, 180);
+      doNotOptimize(result[0]);
+    }
+  }
+
+  COORDS_BENCHMARK(angle_deg2RA_loop_4096) {
+    std::vector<double> result(s_size);
+    for (unsigned long i = 0; i < count; ++i) {
+      for (unsigned long j = 0; j < s_size; ++j)
+	result[j] = Coords::angle::deg2RA(s_degrees[j]);
+      doNotOptimize(result[0]);
+    }
+  }
+
+  COORDS_BENCHMARK(angleArray_deg2RA_4096) {
+    std::vector<double> result(s_size);
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::deg2RA(s_degrees.data(), result.data(), s_size);
+      doNotOptimize(result[0]);
+    }
+  }
+
+  COORDS_BENCHMARK(angleArray_deg2rad_4096) {
+    std::vector<double> result(s_size);
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::deg2rad(s_degrees.data(), result.data(), s_size);
+      doNotOptimize(result[0]);
+    }
+  }
+
+  // a dirty catalog column, one row in four out of range
+  std::vector<double> declinations() {
+    std::vector<double> a(s_size);
+    for (unsigned long i = 0; i < s_size; ++i)
+      a[i] = i % 4 ? (i % 1800) * 0.1 - 90 : 91.0 + i;
+    return a;
+  }
+
+  const std::vector<double> s_declinations(declinations());
+
+  // the throw and catch per bad row that toDeclinations replaces
+  COORDS_BENCHMARK(Declination_ctor_catch_loop_4096) {
+    std::vector<Coords::Declination> result(s_size);
+    for (unsigned long i = 0; i < count; ++i) {
+      unsigned long n(0);
+      for (unsigned long j = 0; j < s_size; ++j) {
+	try {
+	  result[n] = Coords::Declination(s_declinations[j]);
+	  ++n;
+	} catch (Coords::Error& err) {
+	}
+      }
+      doNotOptimize(n);
+    }
+  }
+
+  COORDS_BENCHMARK(angleArray_toDeclinations_4096) {
+    std::vector<Coords::Declination> result(s_size);
+    std::vector<unsigned long> rejects;
+    rejects.reserve(s_size);
+    for (unsigned long i = 0; i < count; ++i) {
+      rejects.clear();
+      doNotOptimize(Coords::toDeclinations(s_declinations.data(), result.data(), s_size, rejects));
+    }
+  }
+
+  // -------------------
+  // ----- parsing -----
+  // -------------------
+
+  // the split on ':' the caller does before the string constructor
+  COORDS_BENCHMARK(angle_string_ctor_split) {
+    const std::string dms("-12:34:56.78");
+    for (unsigned long i = 0; i < count; ++i) {
+      const std::string::size_type m(dms.find(':'));
+      const std::string::size_type s(dms.find(':', m + 1));
+      doNotOptimize(Coords::angle(dms.substr(0, m),
+				  dms.substr(m + 1, s - m - 1),
+				  dms.substr(s + 1)));
+    }
+  }
+
+  COORDS_BENCHMARK(parseSexagesimal) {
+    const std::string dms("-12:34:56.78");
+    double value(0);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(dms);
+      Coords::parseSexagesimal(dms.data(), dms.data() + dms.size(), value);
+      doNotOptimize(value);
+    }
+  }
+
+  std::string sexagesimal_column() {
+    std::stringstream column;
+    for (unsigned long i = 0; i < s_size; ++i)
+      column << (i % 2 ? "-" : "+") << i % 90 << ':' << i % 60 << ':' << (i % 6000)/100.0 << '\n';
+    return column.str();
+  }
+
+  const std::string s_sexagesimal(sexagesimal_column());
+
+  COORDS_BENCHMARK(parseSexagesimal_column_4096) {
+    std::vector<double> result(s_size);
+    std::vector<unsigned long> rejects;
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(Coords::parseSexagesimal(s_sexagesimal.data(),
+					     s_sexagesimal.data() + s_sexagesimal.size(),
+					     result.data(), s_size, rejects));
+      doNotOptimize(result[0]);
+    }
+  }
+
+  // ----------------------
+  // ----- formatting -----
+  // ----------------------
+
+  COORDS_BENCHMARK(degrees2DMSString) {
+    for (unsigned long i = 0; i < count; ++i) {
+      std::stringstream out;
+      Coords::degrees2DMSString(-12.582416666, out);
+      doNotOptimize(out);
+    }
+  }
+
+  COORDS_BENCHMARK(degrees2HMSString) {
+    for (unsigned long i = 0; i < count; ++i) {
+      std::stringstream out;
+      Coords::degrees2HMSString(212.582416666, out);
+      doNotOptimize(out);
+    }
+  }
+
+  COORDS_BENCHMARK(degrees2DMSString_buffer) {
+    char buffer[Coords::angle_string_size];
+    double a(-12.582416666);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(a);
+      doNotOptimize(Coords::degrees2DMSString(a, buffer));
+    }
+  }
+
+  COORDS_BENCHMARK(degrees2HMSString_buffer) {
+    char buffer[Coords::angle_string_size];
+    double a(212.582416666);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(a);
+      doNotOptimize(Coords::degrees2HMSString(a, buffer));
+    }
+  }
+
+  COORDS_BENCHMARK(degrees2HMSString_column_4096) {
+    std::vector<char> buffer(s_size*Coords::angle_string_size);
+    unsigned long length(0);
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::degrees2HMSString(s_degrees.data(), s_size, buffer.data(), buffer.size(), length);
+      doNotOptimize(length);
+    }
+  }
+
+  COORDS_BENCHMARK(angle_operator_output) {
+    const Coords::angle a(212.582416666);
+    for (unsigned long i = 0; i < count; ++i) {
+      std::stringstream out;
+      out << a;
+      doNotOptimize(out);
+    }
+  }
+
+} // end anonymous namespace
@@ -20,7 +20,12 @@
 //  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
 // ================================================================
 
+#include <chrono>
+#include <limits>
+#include <random>
 #include <sstream>
+#include <string>
+#include <type_traits>
 
 #include <gtest/gtest.h>
 
@@ -112,6 +117,14 @@ namespace {
     EXPECT_TRUE(a == b);
   }
 
+  TEST(angle, TriviallyCopyable) {
+    EXPECT_TRUE(std::is_trivially_copyable<Coords::angle>::value);
+    EXPECT_TRUE(std::is_trivially_copyable<Coords::Latitude>::value);
+    EXPECT_TRUE(std::is_trivially_copyable<Coords::Declination>::value);
+    EXPECT_EQ(sizeof(double), sizeof(Coords::angle));
+    EXPECT_EQ(sizeof(double), sizeof(Coords::Latitude));
+  }
+
   TEST(angle, DefaultConstructorRadians) {
     Coords::angle a;
     EXPECT_EQ(0, a.radians());
@@ -669,6 +682,87 @@ namespace {
     EXPECT_STREQ("02:04:06.0", out.str().c_str());
   }
 
+  TEST(angle, output_operator) {
+    Coords::angle a(2, 4, 6);
+
+    std::stringstream out;
+    out << a;
+
+    EXPECT_STREQ("02:04:06.0", out.str().c_str());
+  }
+
+  // the buffer versions write what a new stringstream gets
+
+  void expectSameStrings(const double& a_degrees) {
+    char buffer[Coords::angle_string_size];
+
+    std::stringstream dms;
+    Coords::degrees2DMSString(a_degrees, dms);
+    EXPECT_EQ(dms.str().size(), Coords::degrees2DMSString(a_degrees, buffer));
+    EXPECT_STREQ(dms.str().c_str(), buffer) << std::hexfloat << a_degrees;
+
+    std::stringstream hms;
+    Coords::degrees2HMSString(a_degrees, hms);
+    EXPECT_EQ(hms.str().size(), Coords::degrees2HMSString(a_degrees, buffer));
+    EXPECT_STREQ(hms.str().c_str(), buffer) << std::hexfloat << a_degrees;
+  }
+
+  TEST(angle, output_buffer) {
+    char buffer[Coords::angle_string_size];
+
+    EXPECT_EQ(14, Coords::degrees2DMSString(Coords::angle(12, 34, 56.78).degrees(), buffer));
+    EXPECT_STREQ("12* 34' 56.78\"", buffer);
+
+    EXPECT_EQ(10, Coords::degrees2HMSString(Coords::angle(2, 4, 6).degrees(), buffer));
+    EXPECT_STREQ("02:04:06.0", buffer);
+  }
+
+  TEST(angle, output_buffer_edges) {
+    const double edges[] = {0, -0.0, 1, -1, 0.5, -0.5, 1e-300, -1e-300, 1e-5, 1.0/3600,
+			    1.0/7200, 1.0/60 - 1e-13, 59.99999999, 359.9999999999999,
+			    -12.582416666, 212.582416666, 999999.5, 1234567.75, 1e300,
+			    -1e300, 5e-324, std::numeric_limits<double>::infinity(),
+			    -std::numeric_limits<double>::infinity(),
+			    std::numeric_limits<double>::quiet_NaN()};
+
+    for (unsigned long i = 0; i < sizeof(edges)/sizeof(edges[0]); ++i)
+      expectSameStrings(edges[i]);
+
+    // ties and near ties in the last printed digit of seconds
+    for (int s = 0; s < 60000; ++s)
+      expectSameStrings((s/1000.0 + 0.00005)/3600);
+  }
+
+  TEST(angle, output_buffer_random) {
+    const unsigned int seed(std::chrono::system_clock::now().time_since_epoch().count());
+    std::default_random_engine generator(seed);
+    std::uniform_real_distribution<double> distribution(-720, 720);
+    std::uniform_int_distribution<int> exponent(-30, 30);
+
+    for (int i = 0; i < 100000; ++i) {
+      const double a(distribution(generator));
+      SCOPED_TRACE(seed);
+      expectSameStrings(a);
+      expectSameStrings(ldexp(a, exponent(generator)));
+    }
+  }
+
+  TEST(angle, output_buffer_column) {
+    const double a[] = {-12.582416666, 0, 212.582416666};
+    char buffer[3*Coords::angle_string_size];
+    unsigned long length(0);
+
+    EXPECT_EQ(3, Coords::degrees2DMSString(a, 3, buffer, sizeof(buffer), length));
+    EXPECT_EQ("-12* 34' 56.7\"\n0* 0' 0\"\n212* 34' 56.7\"\n", std::string(buffer, length));
+
+    EXPECT_EQ(3, Coords::degrees2HMSString(a, 3, buffer, sizeof(buffer), length, ','));
+    EXPECT_EQ("-12:34:56.7,00:00:00.0,212:34:56.7,", std::string(buffer, length));
+
+    // stops when a worst case row may not fit
+    EXPECT_EQ(2, Coords::degrees2HMSString(a, 3, buffer, Coords::angle_string_size + 20, length));
+    EXPECT_EQ("-12:34:56.7\n00:00:00.0\n", std::string(buffer, length));
+  }
+
 
   // Latitude
 
@@ -705,6 +799,13 @@ namespace {
 
   }
 
+  TEST(Latitude, IsValid) {
+    EXPECT_TRUE(Coords::Latitude::isValid(90));
+    EXPECT_TRUE(Coords::Latitude::isValid(-90));
+    EXPECT_FALSE(Coords::Latitude::isValid(90.0001));
+    EXPECT_FALSE(Coords::Latitude::isValid(-90.0001));
+  }
+
   TEST(Latitude, Addition) {
     Coords::Latitude a(45);
     Coords::Latitude b(-40);
@@ -751,6 +852,12 @@ namespace {
 
   }
 
+  TEST(Declination, IsValid) {
+    EXPECT_TRUE(Coords::Declination::isValid(0));
+    EXPECT_FALSE(Coords::Declination::isValid(180));
+    EXPECT_FALSE(Coords::Declination::isValid(-180));
+  }
+
   TEST(Declination, Addition) {
     Coords::Declination a(45);
     Coords::Declination b(-40);
@@ -763,6 +870,63 @@ namespace {
   }
 
 
+  // -----------------------
+  // ----- cachedAngle -----
+  // -----------------------
+
+  TEST(cachedAngle, SameAsAngle) {
+    Coords::angle a(37, 15, 21.5);
+    Coords::cachedAngle b(37, 15, 21.5);
+    EXPECT_EQ(a.degrees(), b.degrees());
+    EXPECT_EQ(a.radians(), b.radians());
+    EXPECT_EQ(sin(a.radians()), b.sin());
+    EXPECT_EQ(cos(a.radians()), b.cos());
+    EXPECT_EQ(cos(a.radians()), b.cos()); // cached
+    EXPECT_TRUE(a == b);
+  }
+
+  TEST(cachedAngle, FromAngle) {
+    Coords::Declination a(-30);
+    Coords::cachedAngle b(a);
+    EXPECT_DOUBLE_EQ(-0.5, b.sin());
+    EXPECT_EQ(a.radians(), b.value().radians());
+  }
+
+  TEST(cachedAngle, SetDegreesInvalidates) {
+    Coords::cachedAngle a(90);
+    EXPECT_EQ(1.0, a.sin());
+    a.degrees(0);
+    EXPECT_EQ(0.0, a.radians());
+    EXPECT_EQ(0.0, a.sin());
+    EXPECT_EQ(1.0, a.cos());
+  }
+
+  TEST(cachedAngle, SetRadiansInvalidates) {
+    Coords::cachedAngle a;
+    EXPECT_EQ(1.0, a.cos());
+    a.radians(M_PI);
+    EXPECT_EQ(180.0, a.degrees());
+    EXPECT_EQ(cos(M_PI), a.cos());
+  }
+
+  TEST(cachedAngle, AssignInvalidates) {
+    Coords::cachedAngle a(30);
+    EXPECT_EQ(sin(Coords::angle(30).radians()), a.sin());
+    a = Coords::angle(60);
+    EXPECT_EQ(Coords::angle(60).radians(), a.radians());
+    EXPECT_EQ(sin(Coords::angle(60).radians()), a.sin());
+  }
+
+  TEST(cachedAngle, CopyKeepsCache) {
+    Coords::cachedAngle a(45);
+    a.sin();
+    Coords::cachedAngle b(a);
+    EXPECT_EQ(a.sin(), b.sin());
+    EXPECT_EQ(a.cos(), b.cos());
+    EXPECT_TRUE(std::is_trivially_copyable<Coords::cachedAngle>::value);
+  }
+
+
 } // end anonymous namespace
 
 
@@ -0,0 +1,179 @@
+// ==================================================================
+// Filename:    benchmark.cpp
+//
+// Description: Implements the benchmark registry, the global
+//              operator new used to count allocations and the main()
+//              that runs the benchmarks.
+//
+//              Usage: Coords_benchmark [--min-time=seconds] [filter ...]
+//
+//              Only benchmarks with a name containing one of the
+//              filters are run. The results are JSON on stdout and a
+//              progress table on stderr.
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coordinates is free software: you can redistribute it and/or
+//  modify it under the terms of the GNU General Public License as
+//  published by the Free Software Foundation, either version 3 of the
+//  License, or (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ==================================================================
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <benchmark.h>
+
+// -----------------------------------
+// ----- allocation counting new -----
+// -----------------------------------
+
+namespace {
+
+  std::atomic<unsigned long> s_allocations(0);
+
+  void* counted_new(std::size_t size) {
+    s_allocations.fetch_add(1, std::memory_order_relaxed);
+    void* p(malloc(size == 0 ? 1 : size));
+    if (!p)
+      throw std::bad_alloc();
+    return p;
+  }
+
+} // end anonymous namespace
+
+void* operator new(std::size_t size)   {return counted_new(size);}
+void* operator new[](std::size_t size) {return counted_new(size);}
+
+void operator delete(void* p) noexcept   {free(p);}
+void operator delete[](void* p) noexcept {free(p);}
+
+
+// --------------------
+// ----- registry -----
+// --------------------
+
+namespace {
+
+  struct entry {
+    const char*                  name;
+    Coords::benchmark::function  body;
+  };
+
+  // function local so it is built before the first static registrar
+  std::vector<entry>& registry() {
+    static std::vector<entry> s_registry;
+    return s_registry;
+  }
+
+  struct result {
+    unsigned long count;
+    double        seconds;
+    unsigned long allocations;
+  };
+
+  result time(Coords::benchmark::function body, const unsigned long& count) {
+    result r;
+    r.count = count;
+    const unsigned long allocations(s_allocations.load(std::memory_order_relaxed));
+    std::chrono::steady_clock::time_point start(std::chrono::steady_clock::now());
+    body(count);
+    std::chrono::steady_clock::time_point stop(std::chrono::steady_clock::now());
+    r.allocations = s_allocations.load(std::memory_order_relaxed) - allocations;
+    r.seconds = std::chrono::duration<double>(stop - start).count();
+    return r;
+  }
+
+  // grows the count until a run takes at least min_time
+  result measure(Coords::benchmark::function body, const double& min_time) {
+    body(1); // warm up
+    result r(time(body, 1));
+    while (r.seconds < min_time) {
+      double scale(r.seconds > 0 ? 1.4*min_time/r.seconds : 100);
+      if (scale > 100)
+	scale = 100;
+      if (scale < 2)
+	scale = 2;
+      r = time(body, static_cast<unsigned long>(r.count*scale));
+    }
+    return r;
+  }
+
+  bool selected(const char* name, const std::vector<std::string>& filters) {
+    if (filters.empty())
+      return true;
+    for (unsigned int i = 0; i < filters.size(); ++i)
+      if (strstr(name, filters[i].c_str()))
+	return true;
+    return false;
+  }
+
+} // end anonymous namespace
+
+Coords::benchmark::registrar::registrar(const char* a_name, Coords::benchmark::function a_function) {
+  entry e = {a_name, a_function};
+  registry().push_back(e);
+}
+
+
+// ==================
+// ===== main() =====
+// ==================
+
+int main(int argc, char** argv) {
+
+  double min_time(0.2);
+  std::vector<std::string> filters;
+
+  for (int i = 1; i < argc; ++i) {
+    if (strncmp(argv[i], "--min-time=", 11) == 0)
+      min_time = atof(argv[i] + 11);
+    else
+      filters.push_back(argv[i]);
+  }
+
+  printf("{\n  \"library\": \"libCoords\",\n  \"min_time\": %g,\n  \"benchmarks\": [", min_time);
+
+  const char* separator("\n");
+
+  for (unsigned int i = 0; i < registry().size(); ++i) {
+
+    const entry& e(registry()[i]);
+
+    if (!selected(e.name, filters))
+      continue;
+
+    result r(measure(e.body, min_time));
+
+    const double ns_per_op(1e9*r.seconds/r.count);
+
+    printf("%s    {\"name\": \"%s\", \"iterations\": %lu, \"ns_per_op\": %.4g, \"ops_per_s\": %.4g, \"allocs_per_op\": %.4g}",
+	   separator, e.name, r.count, ns_per_op, r.count/r.seconds,
+	   static_cast<double>(r.allocations)/r.count);
+    separator = ",\n";
+
+    fprintf(stderr, "%-40s %12.3f ns/op %10.3f allocs/op\n",
+	    e.name, ns_per_op, static_cast<double>(r.allocations)/r.count);
+
+  }
+
+  printf("\n  ]\n}\n");
+
+  return 0;
+}
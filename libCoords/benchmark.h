@@ -0,0 +1,68 @@
+// ================================================================
+// Filename:    benchmark.h
+//
+// Description: A small micro benchmark harness for libCoords. Each
+//              benchmark registers itself with COORDS_BENCHMARK and
+//              runs its body count times:
+//
+//                COORDS_BENCHMARK(Cartesian_add) {
+//                  for (unsigned long i = 0; i < count; ++i)
+//                    Coords::benchmark::doNotOptimize(a + b);
+//                }
+//
+//              The benchmark main() in benchmark.cpp calibrates the
+//              count, times every registered benchmark and writes
+//              JSON with ns/op, ops/s and heap allocations/op to
+//              stdout. See make bench.
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coords is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coords is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coords.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#pragma once
+
+namespace Coords {
+
+  namespace benchmark {
+
+    typedef void (*function)(const unsigned long& count);
+
+    // adds a benchmark to the registry, see COORDS_BENCHMARK
+    class registrar {
+    public:
+      registrar(const char* a_name, function a_function);
+    };
+
+    // keeps the optimizer from discarding a result
+    template <class T>
+    inline void doNotOptimize(const T& value) {
+      asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    // forces the optimizer to assume memory has been read and written
+    inline void clobber() {
+      asm volatile("" : : : "memory");
+    }
+
+  } // end namespace benchmark
+
+} // end namespace Coords
+
+#define COORDS_BENCHMARK(a_name)					\
+  static void a_name(const unsigned long& count);			\
+  static Coords::benchmark::registrar a_name##_registrar(#a_name, a_name); \
+  static void a_name(const unsigned long& count)
@@ -27,15 +27,253 @@
 #include <iomanip> // for std::setw() and std::setfill()
 #include <sstream>
 
-#define DEBUG_REGEX 0
-#if DEBUG_REGEX
-#include <iostream>
-#endif
-
 #include<datetime.h>
 #include <utils.h>
 
 
+namespace {
+
+  // ----------------------------
+  // ----- ISO-8601 by hand -----
+  // ----------------------------
+
+  // These match the s_format and s_ISO8601_format regexs in one pass,
+  // including where the regex backtracks.
+
+  const char* s_ISO8601_error(" not in limited ISO-8601 format: year-mm-ddThh:mm:ss[.s*][z|Z|[+|-]hh[[:]mm]]");
+  const char* s_timezone_error(" unsupported timezone format: [z|Z|[+|-]hh[[:]mm]] for -12 < hh < 12");
+
+  using Coords::isDigit;
+
+  inline int twoDigits(const char* p) {return 10*(p[0] - '0') + (p[1] - '0');}
+
+  // the regex's capture groups
+  struct ISO8601Fields {
+    bool        negative;
+    const char* year_begin;
+    const char* year_end;
+    const char* month;
+    const char* day;
+    const char* hour;
+    const char* minute;
+    const char* second_begin;
+    const char* second_end;
+    const char* timezone_begin; // to the end
+  };
+
+  // (-){0,1}(\d*)-, with or without the sign. The regex tries the
+  // sign first, so "-01-01T00:00:00" is year 0 without it.
+  bool matchISO8601(const char* a_begin, const char* a_end, const bool& a_signed,
+		    ISO8601Fields& a_fields) {
+
+    const char* p(a_begin);
+
+    a_fields.negative = a_signed;
+    if (a_signed) {
+      if (p == a_end || *p != '-')
+	return false;
+      ++p;
+    }
+
+    a_fields.year_begin = p;
+    while (p < a_end && isDigit(*p))
+      ++p;
+    a_fields.year_end = p;
+
+    // -mm-ddThh:mm:ss
+    if (a_end - p < 15 || *p != '-')
+      return false;
+    ++p;
+
+    if (!((p[0] == '0' && p[1] >= '1' && p[1] <= '9') ||
+	  (p[0] == '1' && p[1] >= '0' && p[1] <= '2')))
+      return false;
+    a_fields.month = p;
+
+    if (p[2] != '-')
+      return false;
+
+    if (!((p[3] == '0' && p[4] >= '1' && p[4] <= '9') ||
+	  ((p[3] == '1' || p[3] == '2') && isDigit(p[4])) ||
+	  (p[3] == '3' && (p[4] == '0' || p[4] == '1'))))
+      return false;
+    a_fields.day = p + 3;
+
+    if (p[5] != 'T')
+      return false;
+
+    if (!(((p[6] == '0' || p[6] == '1') && isDigit(p[7])) ||
+	  (p[6] == '2' && p[7] >= '0' && p[7] <= '3')))
+      return false;
+    a_fields.hour = p + 6;
+
+    if (p[8] != ':' || p[9] < '0' || p[9] > '5' || !isDigit(p[10]))
+      return false;
+    a_fields.minute = p + 9;
+
+    if (p[11] != ':' || p[12] < '0' || p[12] > '5' || !isDigit(p[13]))
+      return false;
+    a_fields.second_begin = p + 12;
+
+    p += 14;
+
+    if (p < a_end && *p == '.') {
+      ++p;
+      while (p < a_end && isDigit(*p))
+	++p;
+    }
+    a_fields.second_end = p;
+
+    // ([zZ\+-]{0,1}[\d:]*){0,1}, checked by the time zone grammar
+    a_fields.timezone_begin = p;
+
+    if (p < a_end && (*p == 'z' || *p == 'Z' || *p == '+' || *p == '-'))
+      ++p;
+    while (p < a_end && (isDigit(*p) || *p == ':'))
+      ++p;
+
+    return p == a_end;
+  }
+
+  // (\d*) as Coords::stoi(), i.e. 0 if empty
+  int parseYear(const char* a_begin, const char* a_end) {
+
+    if (a_end - a_begin > 9) // may overflow, as the stream does
+      return Coords::stoi(std::string(a_begin, a_end));
+
+    int a_year(0);
+    for (const char* p = a_begin; p < a_end; ++p)
+      a_year = 10*a_year + (*p - '0');
+    return a_year;
+  }
+
+  // (:){0,1}([0-5]\d){0,1} to a_end. a_minutes is -1 if none.
+  bool matchMinutes(const char* p, const char* a_end, bool& a_has_colon, int& a_minutes) {
+
+    a_has_colon = p < a_end && *p == ':';
+    if (a_has_colon)
+      ++p;
+
+    a_minutes = -1;
+    if (a_end - p == 2 && p[0] >= '0' && p[0] <= '5' && isDigit(p[1])) {
+      a_minutes = twoDigits(p);
+      p += 2;
+    }
+
+    return p == a_end;
+  }
+
+  // z|Z|(\+|-){0,1}(0[0-9]|1[012]|[0-9])(\:){0,1}([0-5]\d){0,1}
+  bool matchTimeZone(const char* a_begin, const char* a_end,
+		     bool& a_is_zulu, bool& a_has_colon, double& an_offset) {
+
+    if (a_end - a_begin == 1 && (*a_begin == 'z' || *a_begin == 'Z')) {
+      a_is_zulu = true;
+      a_has_colon = false;
+      an_offset = 0;
+      return true;
+    }
+
+    const char* p(a_begin);
+
+    const bool negative(p < a_end && *p == '-');
+    if (p < a_end && (*p == '+' || *p == '-'))
+      ++p;
+
+    // The hour alternatives in the regex's order, so "120" is 1:20.
+    int hours(-1);
+    int minutes(-1);
+    bool has_colon(false);
+
+    if (a_end - p >= 2 && (p[0] == '0' || (p[0] == '1' && p[1] <= '2')) && isDigit(p[1])
+	&& matchMinutes(p + 2, a_end, has_colon, minutes))
+      hours = twoDigits(p);
+    else if (a_end - p >= 1 && isDigit(p[0]) && matchMinutes(p + 1, a_end, has_colon, minutes))
+      hours = p[0] - '0';
+
+    if (hours < 0)
+      return false;
+
+    a_is_zulu = false;
+    a_has_colon = has_colon;
+
+    an_offset = hours;
+
+    if (minutes >= 0)
+      an_offset += minutes/60.0;
+
+    if (negative)
+      an_offset *= -1;
+
+    return true;
+  }
+
+  // -----------------------
+  // ----- day numbers -----
+  // -----------------------
+
+  const long long s_LilianDay(-141427); // 1582-10-15, in days since the Unix epoch
+  const long long s_UnixEpochMJD(40587); // 1970-01-01 as a Modified Julian Date
+
+  // Years are offset by s_eras 400 year eras, 2.16 billion years,
+  // more than any int year, so they are not negative and every
+  // division is unsigned by a constant, i.e. a multiply and shift,
+  // not a floor.
+  const unsigned long long s_eras(5400000);
+
+  // Days since the Unix epoch of a calendar date, Julian through
+  // 1582-10-04. Years start March 1 so the leap day is last.
+  inline long long toDays(const int& a_year, const int& a_month, const int& a_day) {
+
+    const bool is_julian(a_year < 1582 ||
+			 (a_year == 1582 && (a_month < 10 || (a_month == 10 && a_day <= 4))));
+
+    const unsigned long long y(static_cast<long long>(a_year) - (a_month <= 2) + 400*s_eras);
+    const unsigned int doy((153*(a_month > 2 ? a_month - 3 : a_month + 9) + 2)/5 + a_day - 1);
+
+    // 365 days a year, and a leap day every 4th
+    unsigned long long days(365*y + y/4 + doy);
+
+    // but the 100th, except the 400th
+    if (!is_julian)
+      days = days + y/400 + 3*s_eras + 2 - y/100;
+
+    return static_cast<long long>(days - (365*400 + 100)*s_eras) - 719470;
+  }
+
+  // the inverse, Julian before the Lilian date
+  inline void toCivil(const long long& a_days, int& a_year, int& a_month, int& a_day) {
+
+    unsigned long long years;
+    unsigned int doy;
+
+    if (a_days < s_LilianDay) {
+      const unsigned long long z(a_days + 719470 + 1461*100*s_eras);
+      const unsigned long long era(z/1461);
+      const unsigned int doe(z - 1461*era);
+      const unsigned int yoe((doe - doe/1460)/365);
+      doy = doe - 365*yoe;
+      years = 4*era + yoe;
+    } else {
+      const unsigned long long z(a_days + 719468 + 146097*s_eras);
+      const unsigned long long era(z/146097);
+      const unsigned int doe(z - 146097*era);
+      const unsigned int yoe((doe - doe/1460 + doe/36524 - doe/146096)/365);
+      doy = doe - (365*yoe + yoe/4 - yoe/100);
+      years = 400*era + yoe;
+    }
+
+    const unsigned int mp((5*doy + 2)/153);
+
+    a_day = doy - (153*mp + 2)/5 + 1;
+    a_month = mp < 10 ? mp + 3 : mp - 9;
+    a_year = static_cast<long long>(years - 400*s_eras) + (a_month <= 2);
+  }
+
+} // end anonymous namespace
+
+
+
 // --------------------
 // ----- TimeZone -----
 // --------------------
@@ -55,55 +293,47 @@ Coords::TimeZone::TimeZone(const std::string& a_timezone)
     m_is_zulu(false),
     m_offset(0)
 {
+  std::string emsg;
+  if (!parseISO8601(a_timezone.data(), a_timezone.data() + a_timezone.size(), *this, &emsg))
+    throw Coords::Error(emsg);
+}
 
-  if (a_timezone == "") {
-    m_is_local = true;
-    return;
-  }
+bool Coords::TimeZone::parseISO8601(const char* a_begin, const char* a_end,
+				    Coords::TimeZone& a_result, std::string* a_error) {
 
-#if BOOST_REGEX
-  boost::smatch timezone_match;
-  if (!boost::regex_match(a_timezone, timezone_match, s_regex)) {
-#else
-  std::smatch timezone_match;
-  if (!std::regex_match(a_timezone, timezone_match, s_regex)) {
-#endif
-    std::stringstream emsg;
-    emsg << a_timezone
-	 << " unsupported timezone format: [z|Z|[+|-]hh[[:]mm]] for -12 < hh < 12";
-    throw Coords::Error(emsg.str());
+  if (a_begin == a_end) {
+    a_result.m_has_colon = false;
+    a_result.m_is_local = true;
+    a_result.m_is_zulu = false;
+    a_result.m_offset = 0;
+    return true;
   }
 
-#if DEBUG_REGEX
-  for (int i = 0; i < 6; ++i)
-    std::cout << "timezone_match[" << i << "]" << timezone_match[i] << std::endl;
-#endif
-
-  if (timezone_match[0] == "z" or timezone_match[0] == "Z") {
-    m_is_zulu = true;
-    m_offset = 0;
-
-  } else {
-
-    // m_sign = timezone_match[1];
-    // m_hours = timezone_match[2];
-    // m_minutes = timezone_match[4];
+  bool is_zulu;
+  bool has_colon;
+  double an_offset;
 
-    m_offset = Coords::stod(timezone_match[2]);
-
-    if (timezone_match[3] == ":")
-      m_has_colon = true;
-
-    if (timezone_match[4] != "")
-      m_offset += Coords::stod(timezone_match[4])/60.0;
-
-    if (timezone_match[1] == "-")
-      m_offset *= -1;
+  if (!matchTimeZone(a_begin, a_end, is_zulu, has_colon, an_offset)) {
+    if (a_error)
+      *a_error = std::string(a_begin, a_end) + s_timezone_error;
+    return false;
+  }
 
+  if (an_offset < -12 || an_offset > 12) { // as isValid()
+    if (a_error) {
+      char a_string[Coords::double_string_size];
+      Coords::double2String(an_offset, a_string);
+      *a_error = std::string(a_string) + ": time zone out of range.";
+    }
+    return false;
   }
 
-  isValid(m_offset);
+  a_result.m_has_colon = has_colon;
+  a_result.m_is_local = false;
+  a_result.m_is_zulu = is_zulu;
+  a_result.m_offset = an_offset;
 
+  return true;
 }
 
 
@@ -131,27 +361,6 @@ Coords::TimeZone::TimeZone(const int& a_timezone)
     m_is_zulu = true;
 }
 
-
-// ----- copy constructor -----
-
-Coords::TimeZone::TimeZone(const Coords::TimeZone& a) {
-  m_has_colon = a.m_has_colon;
-  m_is_local = a.m_is_local;
-  m_is_zulu = a.m_is_zulu;
-  m_offset = a.m_offset;
-}
-
-// ----- copy assignment -----
-
-Coords::TimeZone& Coords::TimeZone::operator=(const Coords::TimeZone& rhs) {
-  if (this == &rhs) return *this;
-  m_has_colon = rhs.m_has_colon;
-  m_is_local = rhs.m_is_local;
-  m_is_zulu = rhs.m_is_zulu;
-  m_offset = rhs.m_offset;
-  return *this;
-}
-
 void Coords::TimeZone::isValid(const double& an_offset) {
 
   if (an_offset < -12 || an_offset > 12) {
@@ -215,47 +424,56 @@ Coords::DateTime::DateTime(const std::string& an_iso8601_time)
   m_hour(0),
   m_minute(0),
   m_second(0),
+  m_is_leap_year(false),
   m_timezone(0)
 {
+  std::string emsg;
+  if (!parseISO8601(an_iso8601_time.data(), an_iso8601_time.data() + an_iso8601_time.size(),
+		    *this, &emsg))
+    throw Coords::Error(emsg);
+}
 
+bool Coords::DateTime::parseISO8601(const char* a_begin, const char* a_end,
+				    Coords::DateTime& a_result, std::string* a_error) {
 
-#if BOOST_REGEX
-  boost::smatch iso8601_match;
-  if (!boost::regex_match(an_iso8601_time, iso8601_match, s_ISO8601_regex)) {
-#else
-  std::smatch iso8601_match;
-  if (!std::regex_match(an_iso8601_time, iso8601_match, s_ISO8601_regex)) {
-#endif
-    std::stringstream emsg;
-    emsg << an_iso8601_time << " not in limited ISO-8601 format: year-mm-ddThh:mm:ss[.s*][z|Z|[+|-]hh[[:]mm]]";
-    throw Coords::Error(emsg.str());
+  ISO8601Fields fields;
+
+  if (!matchISO8601(a_begin, a_end, true, fields) && !matchISO8601(a_begin, a_end, false, fields)) {
+    if (a_error)
+      *a_error = std::string(a_begin, a_end) + s_ISO8601_error;
+    return false;
   }
 
-#if DEBUG_REGEX
-  for (int i = 0; i < 15; ++i)
-    std::cout << "iso8601_match[" << i << "]" << iso8601_match[i] << std::endl;
-#endif
+  Coords::DateTime a_datetime(a_result);
 
-  m_year = Coords::stoi(iso8601_match[2]);
+  a_datetime.m_year = parseYear(fields.year_begin, fields.year_end);
 
-  if (iso8601_match[1] == "-")
-    m_year *= -1;
+  if (fields.negative)
+    a_datetime.m_year *= -1;
 
-  m_month = Coords::stoi(iso8601_match[3]);
-  m_day = Coords::stoi(iso8601_match[4]);
+  a_datetime.m_month = twoDigits(fields.month);
+  a_datetime.m_day = twoDigits(fields.day);
 
-  if ((m_year % 4 == 0 && m_year % 100 != 0) || m_year % 400 == 0)
-    m_is_leap_year = true;
-  else
-    m_is_leap_year = false;
+  a_datetime.m_is_leap_year = leapYear(a_datetime.m_year);
 
-  m_hour = Coords::stoi(iso8601_match[5]);
-  m_minute = Coords::stoi(iso8601_match[6]);
-  m_second = Coords::stod(iso8601_match[7]);
+  a_datetime.m_hour = twoDigits(fields.hour);
+  a_datetime.m_minute = twoDigits(fields.minute);
+  Coords::parseDouble(fields.second_begin, fields.second_end, a_datetime.m_second);
 
-  m_timezone = TimeZone(iso8601_match[9]);
+  if (!TimeZone::parseISO8601(fields.timezone_begin, a_end, a_datetime.m_timezone, a_error))
+    return false;
+
+  const char* msg(a_datetime.validationError());
+
+  if (msg) {
+    if (a_error)
+      *a_error = std::string(a_begin, a_end) + ": " + msg;
+    return false;
+  }
 
-  isValid(an_iso8601_time);
+  a_result = a_datetime;
+
+  return true;
 }
 
 Coords::DateTime::DateTime(const double& a_jdate)
@@ -289,37 +507,44 @@ void Coords::DateTime::throwError(const std::string& a_datetime, const std::stri
 }
 
 void Coords::DateTime::isValid(const std::string& an_iso8601_time) {
+  const char* msg(validationError());
+  if (msg)
+    throwError(an_iso8601_time, msg);
+}
+
+const char* Coords::DateTime::validationError() const {
 
   if (m_month < 1 || m_month > 12)
-    throwError(an_iso8601_time, "month out of range.");
+    return "month out of range.";
 
   if (m_day < 1 || m_day > 31)
-    throwError(an_iso8601_time, "day out of range.");
+    return "day out of range.";
 
   if ((m_month == 9 || m_month == 4 || m_month == 6 || m_month == 11) && m_day > 30)
-    throwError(an_iso8601_time, "Thirty days hath September, April, June and November");
+    return "Thirty days hath September, April, June and November";
 
   if (m_is_leap_year) {
 
     if (m_month == 2 && m_day > 29)
-      throwError(an_iso8601_time, "Except for February all alone. It has 28, but 29 each _leap_ year.");
+      return "Except for February all alone. It has 28, but 29 each _leap_ year.";
 
   } else {
 
     if (m_month == 2 && m_day > 28)
-      throwError(an_iso8601_time, "Except for February all alone. It has _28_, but 29 each leap year.");
+      return "Except for February all alone. It has _28_, but 29 each leap year.";
 
   }
 
   if (m_hour < 0 || m_hour > 24)
-    throwError(an_iso8601_time, "hour out of range.");
+    return "hour out of range.";
 
   if (m_minute < 0 || m_minute > 60)
-    throwError(an_iso8601_time, "minute out of range.");
+    return "minute out of range.";
 
   if (m_second < 0 || m_second > 60)
-    throwError(an_iso8601_time, "second out of range.");
+    return "second out of range.";
 
+  return 0;
 }
 
 // ----- copy constructor -----
@@ -430,6 +655,48 @@ Coords::DateTime Coords::DateTime::inTimeZone(const Coords::TimeZone& a_new_time
 // --------------------------
 
 
+double Coords::DateTime::toModifiedJulianDate() const {
+
+  // APC with the day from integer days from civil
+
+  const long long jdays(daysFromCivil(m_year, m_month, m_day) + s_UnixEpochMJD); // at midnight
+
+  double partial_day(Coords::degrees2seconds(m_hour, m_minute, m_second)/86400.0);
+
+  return static_cast<double>(jdays) + partial_day - m_timezone.offset()/24.0;
+
+}
+
+// TODO static method?
+Coords::DateTime Coords::DateTime::fromModifiedJulianDate(const double& jdays) const {
+
+  // ASSUMES: jdays are Modified Julian Days
+
+  int a_year(0);
+  int a_month(0);
+  int a_day(0);
+  int a_hour(0);
+  int a_minute(0);
+  double a_second(0);
+
+  civilFromDays(static_cast<long long>(floor(jdays)) - s_UnixEpochMJD, a_year, a_month, a_day);
+
+  double d_hour = 24.0 * (jdays - floor(jdays));
+  a_hour = d_hour; // implicit cast to int
+
+  double d_minute = 60.0 * (d_hour - floor(d_hour));
+  a_minute = d_minute; // implicit cast to int
+
+  a_second = 60.0 * (d_minute - floor(d_minute));
+
+
+  Coords::DateTime new_datetime(a_year, a_month, a_day, a_hour, a_minute, a_second);
+
+  return new_datetime;
+
+}
+
+
 double Coords::DateTime::toModifiedJulianDateAPC() const {
 
   // Calculates Julian day number from Gregorian calendar date.
@@ -707,6 +974,51 @@ Coords::DateTime Coords::DateTime::fromJulianDateWiki(const double& jdays) const
 }
 
 
+// -----------------------
+// ----- day numbers -----
+// -----------------------
+
+long long Coords::daysFromCivil(const int& a_year, const int& a_month, const int& a_day) {
+  return toDays(a_year, a_month, a_day);
+}
+
+void Coords::civilFromDays(const long long& a_days, int& a_year, int& a_month, int& a_day) {
+  toCivil(a_days, a_year, a_month, a_day);
+}
+
+void Coords::daysFromCivil(const int* a_year, const int* a_month, const int* a_day,
+			   long long* a_days, const unsigned long& a_size) {
+  for (unsigned long i = 0; i < a_size; ++i)
+    a_days[i] = toDays(a_year[i], a_month[i], a_day[i]);
+}
+
+void Coords::civilFromDays(const long long* a_days, int* a_year, int* a_month, int* a_day,
+			   const unsigned long& a_size) {
+  for (unsigned long i = 0; i < a_size; ++i)
+    toCivil(a_days[i], a_year[i], a_month[i], a_day[i]);
+}
+
+
+// -------------------------
+// ----- batch parsing -----
+// -------------------------
+
+unsigned long Coords::parseISO8601(const std::string* a_strings, const unsigned long& a_size,
+				   Coords::DateTime* a_result, std::vector<unsigned long>& a_rejects) {
+  unsigned long parsed(0);
+
+  for (unsigned long i = 0; i < a_size; ++i) {
+    const std::string& a_string(a_strings[i]);
+    if (DateTime::parseISO8601(a_string.data(), a_string.data() + a_string.size(), a_result[i]))
+      ++parsed;
+    else
+      a_rejects.push_back(i);
+  }
+
+  return parsed;
+}
+
+
 // <<<<<<<<<<<<<<<<<<<<<<<<<<<<
 // <<<<< string utilities <<<<<
 // <<<<<<<<<<<<<<<<<<<<<<<<<<<<
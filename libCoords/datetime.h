@@ -32,6 +32,9 @@
 #include <regex>
 #endif
 
+#include <string>
+#include <vector>
+
 #include <utils.h>
 
 namespace Coords {
@@ -46,12 +49,21 @@ namespace Coords {
 
     static const std::string s_format;
 
+    // The string constructor's grammar. It is matched by hand, for
+    // speed, accepting exactly what this regex does.
 #if BOOST_REGEX
     static const boost::regex s_regex;
 #else
     static const std::regex s_regex;
 #endif
 
+    // Parses [a_begin, a_end) as the string constructor, without
+    // throwing. Returns false, and leaves a_result unchanged, where
+    // the constructor would throw, with its message in *a_error if
+    // given.
+    static bool parseISO8601(const char* a_begin, const char* a_end,
+			     TimeZone& a_result, std::string* a_error=0);
+
     void isValid(const double& an_offset);
     void throwError(const std::string& a_timezone, const std::string msg);
 
@@ -65,10 +77,8 @@ namespace Coords {
     explicit TimeZone(const double& a_timezone);
     explicit TimeZone(const int& a_timezone);
 
-    ~TimeZone() {};
-
-    TimeZone(const TimeZone& a);
-    TimeZone& operator=(const TimeZone& rhs);
+    // The compiler generated copy constructor, copy assignment and
+    // destructor keep TimeZone trivially copyable.
 
     // accessors
 
@@ -95,12 +105,21 @@ namespace Coords {
 
     static const std::string s_ISO8601_format;
 
+    // The string constructor's grammar. It is matched by hand, for
+    // speed, accepting exactly what this regex does.
 #if BOOST_REGEX
     static const boost::regex s_ISO8601_regex;
 #else
     static const std::regex s_ISO8601_regex;
 #endif
 
+    // Parses [a_begin, a_end) as the string constructor, without
+    // throwing. Returns false, and leaves a_result unchanged, where
+    // the constructor would throw, with its message in *a_error if
+    // given.
+    static bool parseISO8601(const char* a_begin, const char* a_end,
+			     DateTime& a_result, std::string* a_error=0);
+
     static const long int s_gDateNRC; // used in NRC Julian Date calculations.
 
     static const double   s_LilianDate; // Gregorian calendar adopted Oct. 15, 1582
@@ -110,6 +129,9 @@ namespace Coords {
 
     static const double   s_resolution; // for rounding seconds
 
+    static bool leapYear(const int& a_year) { // Gregorian rule, as isValid() uses
+      return (a_year % 4 == 0 && a_year % 100 != 0) || a_year % 400 == 0;}
+
     // ----- constructors -----
 
     explicit DateTime(const std::string& an_iso8601_time);
@@ -129,6 +151,7 @@ namespace Coords {
       m_hour(a_hour),
       m_minute(a_minute),
       m_second(a_second),
+      m_is_leap_year(leapYear(a_year)),
       m_timezone(a_timezone)
       {isValid();};
 
@@ -145,6 +168,7 @@ namespace Coords {
       m_hour(a_hour),
       m_minute(a_minute),
       m_second(a_second),
+      m_is_leap_year(leapYear(a_year)),
       m_timezone(a_timezone)
       {isValid();};
 
@@ -161,6 +185,7 @@ namespace Coords {
       m_hour(a_hour),
       m_minute(a_minute),
       m_second(a_second),
+      m_is_leap_year(leapYear(a_year)),
       m_timezone(a_timezone)
       {isValid();};
 
@@ -224,10 +249,14 @@ namespace Coords {
 
     // ----- Julian date methods -----
 
-    double   toJulianDate() const {return toModifiedJulianDateAPC() + s_ModifiedJulianDate;}
+    double   toJulianDate() const {return toModifiedJulianDate() + s_ModifiedJulianDate;}
 
     DateTime fromJulianDate(const double& jdays) const {
-      return fromModifiedJulianDateAPC(jdays - s_ModifiedJulianDate);} // TODO static method?
+      return fromModifiedJulianDate(jdays - s_ModifiedJulianDate);} // TODO static method?
+
+    // The day by daysFromCivil() in integers, the time of day as APC.
+    double   toModifiedJulianDate() const;
+    DateTime fromModifiedJulianDate(const double& jdays) const; // TODO static method?
 
 
     double   toJulianDateWiki() const;
@@ -248,6 +277,8 @@ namespace Coords {
 
   private:
 
+    const char* validationError() const; // isValid()'s message, 0 if valid
+
     int m_year;
     int m_month;
     int m_day;
@@ -263,6 +294,50 @@ namespace Coords {
 
 
 
+  // -----------------------
+  // ----- day numbers -----
+  // -----------------------
+
+  // Days since the Unix epoch, 1970-01-01, of a calendar date, and
+  // back, in integer arithmetic only. The Julian day number is
+  // days + 2440588. Years are astronomical, i.e. there is a year 0.
+  //
+  // Dates through 1582-10-04 are in the Julian calendar and from
+  // 1582-10-15, the Lilian date, in the Gregorian, as the APC Julian
+  // date methods. The days skipped in between are taken as Gregorian
+  // and come back as Julian dates. Fields are not checked, months
+  // must be 1 to 12.
+  //
+  // Every int year is supported. civilFromDays() is only defined for
+  // days that daysFromCivil() returns for an int year, about
+  // +/-7.8e11.
+
+  long long daysFromCivil(const int& a_year, const int& a_month, const int& a_day);
+
+  void civilFromDays(const long long& a_days, int& a_year, int& a_month, int& a_day);
+
+  // columns of a_size dates, e.g. a catalog's
+  void daysFromCivil(const int* a_year, const int* a_month, const int* a_day,
+		     long long* a_days, const unsigned long& a_size);
+
+  void civilFromDays(const long long* a_days, int* a_year, int* a_month, int* a_day,
+		     const unsigned long& a_size);
+
+
+  // -------------------------
+  // ----- batch parsing -----
+  // -------------------------
+
+  // Parses a_size ISO-8601 strings into a_result as the string
+  // constructor, without throwing, e.g. for a catalog's time
+  // column. A string the constructor would reject leaves its a_result
+  // unchanged and its index is appended to a_rejects; parse it alone
+  // with DateTime::parseISO8601 for the message. Returns the number
+  // parsed.
+  unsigned long parseISO8601(const std::string* a_strings, const unsigned long& a_size,
+			     DateTime* a_result, std::vector<unsigned long>& a_rejects);
+
+
   // +++++++++++++++++++++
   // +++++ operators +++++
   // +++++++++++++++++++++
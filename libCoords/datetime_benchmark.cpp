@@ -0,0 +1,244 @@
+// ================================================================
+// Filename:    datetime_benchmark.cpp
+// Description: Benchmarks of ISO-8601 parsing, the Julian date
+//              conversions and DateTime arithmetic.
+//
+// Author:      L.R. McFarland, lrm@starbug.com
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coordinates is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <benchmark.h>
+#include <datetime.h>
+
+namespace {
+
+  using Coords::benchmark::doNotOptimize;
+
+  // not a global, the library's regex statics may not be built yet
+  const Coords::DateTime& datetime() {
+    static const Coords::DateTime s_datetime("2019-09-18T17:30:00.25-08:00");
+    return s_datetime;
+  }
+
+  // -------------------
+  // ----- parsing -----
+  // -------------------
+
+  COORDS_BENCHMARK(DateTime_parse) {
+    const std::string iso8601("2019-09-18T17:30:00.25-08:00");
+    for (unsigned long i = 0; i < count; ++i)
+      doNotOptimize(Coords::DateTime(iso8601));
+  }
+
+  COORDS_BENCHMARK(DateTime_parse_zulu) {
+    const std::string iso8601("2000-01-01T12:00:00Z");
+    for (unsigned long i = 0; i < count; ++i)
+      doNotOptimize(Coords::DateTime(iso8601));
+  }
+
+  // The constructor as it was, matching both regexs and converting
+  // the fields through string streams, for comparison.
+  COORDS_BENCHMARK(DateTime_parse_regex) {
+    const std::string iso8601("2019-09-18T17:30:00.25-08:00");
+    for (unsigned long i = 0; i < count; ++i) {
+      std::smatch iso8601_match;
+      std::regex_match(iso8601, iso8601_match, Coords::DateTime::s_ISO8601_regex);
+      doNotOptimize(Coords::stoi(iso8601_match[2]) + Coords::stoi(iso8601_match[3]) +
+		    Coords::stoi(iso8601_match[4]) + Coords::stoi(iso8601_match[5]) +
+		    Coords::stoi(iso8601_match[6]) + Coords::stod(iso8601_match[7]));
+      const std::string a_timezone(iso8601_match[9]);
+      std::smatch timezone_match;
+      std::regex_match(a_timezone, timezone_match, Coords::TimeZone::s_regex);
+      doNotOptimize(Coords::stod(timezone_match[2]) + Coords::stod(timezone_match[4])/60.0);
+    }
+  }
+
+  COORDS_BENCHMARK(DateTime_parseISO8601) {
+    const std::string iso8601("2019-09-18T17:30:00.25-08:00");
+    Coords::DateTime a;
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::DateTime::parseISO8601(iso8601.data(), iso8601.data() + iso8601.size(), a);
+      doNotOptimize(a);
+    }
+  }
+
+  COORDS_BENCHMARK(parseISO8601_4096) {
+    std::vector<std::string> strings;
+    for (int day = 1; strings.size() < 4096; day = day % 28 + 1) {
+      char a_string[32];
+      snprintf(a_string, sizeof(a_string), "2019-09-%02dT17:30:%02d.25-08:00", day, day);
+      strings.push_back(a_string);
+    }
+
+    std::vector<Coords::DateTime> result(strings.size());
+    std::vector<unsigned long> rejects;
+
+    for (unsigned long i = 0; i < count; ++i) {
+      rejects.clear();
+      doNotOptimize(Coords::parseISO8601(strings.data(), strings.size(), result.data(), rejects));
+    }
+  }
+
+  COORDS_BENCHMARK(TimeZone_parse) {
+    const std::string a_timezone("-08:00");
+    for (unsigned long i = 0; i < count; ++i)
+      doNotOptimize(Coords::TimeZone(a_timezone));
+  }
+
+  COORDS_BENCHMARK(DateTime_operator_output) {
+    for (unsigned long i = 0; i < count; ++i) {
+      std::stringstream out;
+      out << datetime();
+      doNotOptimize(out);
+    }
+  }
+
+  // ------------------------
+  // ----- Julian dates -----
+  // ------------------------
+
+  COORDS_BENCHMARK(DateTime_toJulianDate) {
+    for (unsigned long i = 0; i < count; ++i)
+      doNotOptimize(datetime().toJulianDate());
+  }
+
+  COORDS_BENCHMARK(DateTime_toJulianDateNRC) {
+    for (unsigned long i = 0; i < count; ++i)
+      doNotOptimize(datetime().toJulianDateNRC());
+  }
+
+  COORDS_BENCHMARK(DateTime_toJulianDateWiki) {
+    for (unsigned long i = 0; i < count; ++i)
+      doNotOptimize(datetime().toJulianDateWiki());
+  }
+
+  COORDS_BENCHMARK(DateTime_fromJulianDate) {
+    const double jd(datetime().toJulianDate());
+    for (unsigned long i = 0; i < count; ++i)
+      doNotOptimize(datetime().fromJulianDate(jd));
+  }
+
+  COORDS_BENCHMARK(DateTime_fromJulianDateNRC) {
+    const double jd(datetime().toJulianDate());
+    for (unsigned long i = 0; i < count; ++i)
+      doNotOptimize(datetime().fromJulianDateNRC(jd));
+  }
+
+  COORDS_BENCHMARK(DateTime_fromJulianDateWiki) {
+    const double jd(datetime().toJulianDate());
+    for (unsigned long i = 0; i < count; ++i)
+      doNotOptimize(datetime().fromJulianDateWiki(jd));
+  }
+
+  COORDS_BENCHMARK(DateTime_toModifiedJulianDate) {
+    for (unsigned long i = 0; i < count; ++i)
+      doNotOptimize(datetime().toModifiedJulianDate());
+  }
+
+  COORDS_BENCHMARK(DateTime_toModifiedJulianDateAPC) {
+    for (unsigned long i = 0; i < count; ++i)
+      doNotOptimize(datetime().toModifiedJulianDateAPC());
+  }
+
+  COORDS_BENCHMARK(DateTime_fromModifiedJulianDate) {
+    const double jd(datetime().toModifiedJulianDate());
+    for (unsigned long i = 0; i < count; ++i)
+      doNotOptimize(datetime().fromModifiedJulianDate(jd));
+  }
+
+  COORDS_BENCHMARK(DateTime_fromModifiedJulianDateAPC) {
+    const double jd(datetime().toModifiedJulianDate());
+    for (unsigned long i = 0; i < count; ++i)
+      doNotOptimize(datetime().fromModifiedJulianDateAPC(jd));
+  }
+
+  COORDS_BENCHMARK(DateTime_add_days) {
+    Coords::DateTime a(datetime());
+    for (unsigned long i = 0; i < count; ++i) {
+      a += 0.125;
+      doNotOptimize(a);
+    }
+  }
+
+  // -----------------------
+  // ----- day numbers -----
+  // -----------------------
+
+  const unsigned long s_size(4096);
+
+  COORDS_BENCHMARK(daysFromCivil) {
+    int a_year(2019);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(Coords::daysFromCivil(a_year, 9, 18));
+      doNotOptimize(a_year);
+    }
+  }
+
+  COORDS_BENCHMARK(civilFromDays) {
+    long long days(18157);
+    int a_year, a_month, a_day;
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(days);
+      Coords::civilFromDays(days, a_year, a_month, a_day);
+      doNotOptimize(a_day);
+    }
+  }
+
+  // the day of s_size dates, a column at a time or each by APC
+  COORDS_BENCHMARK(daysFromCivil_4096) {
+    std::vector<int> years(s_size), months(s_size), days(s_size);
+    std::vector<long long> result(s_size);
+    for (unsigned long i = 0; i < s_size; ++i) {
+      years[i] = 1600 + i % 800;
+      months[i] = 1 + i % 12;
+      days[i] = 1 + i % 28;
+    }
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::daysFromCivil(years.data(), months.data(), days.data(), result.data(), s_size);
+      doNotOptimize(result);
+    }
+  }
+
+  COORDS_BENCHMARK(toModifiedJulianDateAPC_4096) {
+    std::vector<Coords::DateTime> dates;
+    for (unsigned long i = 0; i < s_size; ++i)
+      dates.push_back(Coords::DateTime(1600 + i % 800, 1 + i % 12, 1 + i % 28));
+    std::vector<double> result(s_size);
+    for (unsigned long i = 0; i < count; ++i) {
+      for (unsigned long j = 0; j < s_size; ++j)
+	result[j] = dates[j].toModifiedJulianDateAPC();
+      doNotOptimize(result);
+    }
+  }
+
+  COORDS_BENCHMARK(civilFromDays_4096) {
+    std::vector<long long> days(s_size);
+    std::vector<int> years(s_size), months(s_size), a_days(s_size);
+    for (unsigned long i = 0; i < s_size; ++i)
+      days[i] = -150000 + 73*i;
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::civilFromDays(days.data(), years.data(), months.data(), a_days.data(), s_size);
+      doNotOptimize(a_days);
+    }
+  }
+
+} // end anonymous namespace
@@ -20,8 +20,13 @@
 //  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
 // ================================================================
 
+#include <chrono>
+#include <cstdio>
 #include <iomanip> // for std::setw() and std::setfill()
+#include <limits>
+#include <random>
 #include <sstream>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -2759,6 +2764,429 @@ namespace {
 
 
 
+  // -------------------------------------
+  // ----- ISO-8601 parser vs regex -----
+  // -------------------------------------
+
+  // The fields, or error message, the constructor made from the regex
+  // match before the parser was written by hand.
+
+  std::string fields(const Coords::TimeZone& a);
+
+  std::string fields(const Coords::DateTime& a) {
+    char buffer[256];
+    snprintf(buffer, sizeof(buffer), "%d %d %d %d %d %.17g %d %s",
+	     a.year(), a.month(), a.day(), a.hour(), a.minute(), a.second(), a.isLeapYear(),
+	     fields(a.timezone()).c_str());
+    return buffer;
+  }
+
+  std::string fields(const Coords::TimeZone& a) {
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%d %d %d %.17g", a.isLocal(), a.isZulu(), a.hasColon(), a.offset());
+    return buffer;
+  }
+
+  // The TimeZone's fields, or error message. a_fields is only set if valid.
+  bool byRegex(const std::string& a_timezone, std::string& a_fields) {
+
+    bool is_local(false), is_zulu(false), has_colon(false);
+    double offset(0);
+
+    std::smatch timezone_match;
+    if (a_timezone == "") {
+      is_local = true;
+    } else if (!std::regex_match(a_timezone, timezone_match, Coords::TimeZone::s_regex)) {
+      a_fields = a_timezone + " unsupported timezone format: [z|Z|[+|-]hh[[:]mm]] for -12 < hh < 12";
+      return false;
+    } else if (timezone_match[0] == "z" or timezone_match[0] == "Z") {
+      is_zulu = true;
+    } else {
+      offset = Coords::stod(timezone_match[2]);
+      has_colon = timezone_match[3] == ":";
+      if (timezone_match[4] != "")
+	offset += Coords::stod(timezone_match[4])/60.0;
+      if (timezone_match[1] == "-")
+	offset *= -1;
+      if (offset < -12 || offset > 12) {
+	std::stringstream emsg;
+	emsg << offset << ": time zone out of range.";
+	a_fields = emsg.str();
+	return false;
+      }
+    }
+
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%d %d %d %.17g", is_local, is_zulu, has_colon, offset);
+    a_fields = buffer;
+    return true;
+  }
+
+  std::string byRegex(const std::string& an_iso8601_time) {
+
+    std::smatch iso8601_match;
+    if (!std::regex_match(an_iso8601_time, iso8601_match, Coords::DateTime::s_ISO8601_regex))
+      return an_iso8601_time + " not in limited ISO-8601 format: year-mm-ddThh:mm:ss[.s*][z|Z|[+|-]hh[[:]mm]]";
+
+    // Coords::stoi("") leaves its int unset, the parser makes it 0
+    int year(iso8601_match[2] == "" ? 0 : Coords::stoi(iso8601_match[2]));
+    if (iso8601_match[1] == "-")
+      year *= -1;
+
+    const int month(Coords::stoi(iso8601_match[3]));
+    const int day(Coords::stoi(iso8601_match[4]));
+    const bool is_leap_year((year % 4 == 0 && year % 100 != 0) || year % 400 == 0);
+
+    std::string a_timezone;
+    if (!byRegex(iso8601_match[9], a_timezone))
+      return a_timezone;
+
+    // the regex allows only the calendar checks to fail
+    if ((month == 9 || month == 4 || month == 6 || month == 11) && day > 30)
+      return an_iso8601_time + ": Thirty days hath September, April, June and November";
+    if (is_leap_year && month == 2 && day > 29)
+      return an_iso8601_time + ": Except for February all alone. It has 28, but 29 each _leap_ year.";
+    if (!is_leap_year && month == 2 && day > 28)
+      return an_iso8601_time + ": Except for February all alone. It has _28_, but 29 each leap year.";
+
+    char buffer[256];
+    snprintf(buffer, sizeof(buffer), "%d %d %d %d %d %.17g %d %s",
+	     year, month, day, Coords::stoi(iso8601_match[5]), Coords::stoi(iso8601_match[6]),
+	     Coords::stod(iso8601_match[7]), is_leap_year, a_timezone.c_str());
+    return buffer;
+  }
+
+  std::string byConstructor(const std::string& an_iso8601_time) {
+    try {
+      return fields(Coords::DateTime(an_iso8601_time));
+    } catch (Coords::Error& err) {
+      return err.what();
+    }
+  }
+
+  TEST(ISO8601, SameAsRegex) {
+    const char* strings[] = {
+      "2019-09-18T17:30:00.25-08:00", "2000-01-01T12:00:00Z", "2000-01-01T12:00:00z",
+      "-0044-03-15T12:00:00", "-01-01T00:00:00", "--01-01T00:00:00", "-2016-01-01T00:00:00",
+      "01-01T00:00:00", "2016-02-29T00:00:00", "2015-02-29T00:00:00", "2000-02-30T00:00:00",
+      "1900-02-29T00:00:00", "2014-09-31T00:00:00", "2014-12-07T12:34:56.", "2014-12-07T12:34:56.78",
+      "2014-12-07T12:34:56+0430", "2014-12-07T12:34:56-04:30", "2014-12-07T12:34:56+120",
+      "2014-12-07T12:34:56+1230", "2014-12-07T12:34:56-12:30", "2014-12-07T12:34:56+12",
+      "2014-12-07T12:34:56120", "2014-12-07T12:34:561", "2014-12-07T12:34:56.5:30",
+      "2014-12-07T12:34:56+05:", "2014-12-07T12:34:56+5", "2014-12-07T12:34:56+13",
+      "2014-12-07T12:34:56+05:6", "2014-12-07T12:34:56Z5", "2014-12-07T12:34:56+",
+      "2014-12-07T12:34:56+13.987", "2014-12-07T24:00:00", "2014-12-07T23:60:00",
+      "2014-12-07T23:59:60", "2014-13-07T00:00:00", "2014-00-07T00:00:00", "2014-12-00T00:00:00",
+      "2014-12-32T00:00:00", "2014-12-07 12:34:56", "2014-12-07t12:34:56", "2014-12-07T12:34",
+      "99999999999-01-01T00:00:00", "-99999999999-01-01T00:00:00", "0000000002016-02-29T00:00:00",
+      "", "-", "T", "2014-12-07T12:34:56 "};
+
+    for (unsigned long i = 0; i < sizeof(strings)/sizeof(strings[0]); ++i)
+      EXPECT_EQ(byRegex(strings[i]), byConstructor(strings[i])) << "'" << strings[i] << "'";
+  }
+
+  TEST(ISO8601, TimeZoneSameAsRegex) {
+    const char* strings[] = {"", "z", "Z", "zz", "+", "-", "0", "9", "12", "13", "120", "1230",
+			     "12:30", "-12:00", "+05:", "05:6", "05:60", "+0530", "1:", "::", "-00"};
+
+    for (unsigned long i = 0; i < sizeof(strings)/sizeof(strings[0]); ++i) {
+      std::string expected;
+      byRegex(strings[i], expected);
+      try {
+	EXPECT_EQ(expected, fields(Coords::TimeZone(strings[i]))) << "'" << strings[i] << "'";
+      } catch (Coords::Error& err) {
+	EXPECT_EQ(expected, err.what()) << "'" << strings[i] << "'";
+      }
+    }
+  }
+
+  TEST(ISO8601, ParseRange) {
+    const char buffer[] = "2000-01-01T12:00:00Z trailing";
+    Coords::DateTime a;
+    EXPECT_TRUE(Coords::DateTime::parseISO8601(buffer, buffer + 20, a));
+    EXPECT_EQ(fields(Coords::DateTime("2000-01-01T12:00:00Z")), fields(a));
+  }
+
+  TEST(ISO8601, ParseError) {
+    const std::string bad("2015-02-29T00:00:00");
+    Coords::DateTime a("2001-02-03T00:00:00");
+    const std::string before(fields(a));
+    std::string emsg;
+
+    EXPECT_FALSE(Coords::DateTime::parseISO8601(bad.data(), bad.data() + bad.size(), a, &emsg));
+    EXPECT_EQ(byRegex(bad), emsg);
+    EXPECT_EQ(before, fields(a));
+  }
+
+  TEST(ISO8601, Batch) {
+    const std::string strings[] = {"2019-09-18T17:30:00.25-08:00", "2015-02-29T00:00:00",
+				   "-0044-03-15T12:00:00", "yesterday", "2000-01-01T12:00:00Z"};
+    const unsigned long size(sizeof(strings)/sizeof(strings[0]));
+    std::vector<Coords::DateTime> result(size);
+    std::vector<unsigned long> rejects;
+
+    EXPECT_EQ(3, Coords::parseISO8601(strings, size, result.data(), rejects));
+
+    ASSERT_EQ(2, rejects.size());
+    EXPECT_EQ(1, rejects[0]);
+    EXPECT_EQ(3, rejects[1]);
+
+    EXPECT_EQ(byRegex(strings[0]), fields(result[0]));
+    std::stringstream unchanged, expected;
+    unchanged << result[1];
+    expected << Coords::DateTime();
+    EXPECT_EQ(expected.str(), unchanged.str());
+    EXPECT_EQ(byRegex(strings[2]), fields(result[2]));
+    EXPECT_EQ(byRegex(strings[4]), fields(result[4]));
+  }
+
+  // -----------------------
+  // ----- day numbers -----
+  // -----------------------
+
+  TEST(DayNumbers, Fixed) {
+    EXPECT_EQ(0, Coords::daysFromCivil(1970, 1, 1));
+    EXPECT_EQ(10957, Coords::daysFromCivil(2000, 1, 1));
+    EXPECT_EQ(-141427, Coords::daysFromCivil(1582, 10, 15)); // Lilian date
+    EXPECT_EQ(-141428, Coords::daysFromCivil(1582, 10, 4)); // Julian the day before
+    EXPECT_EQ(-2440588, Coords::daysFromCivil(-4712, 1, 1)); // Julian day number 0
+    EXPECT_EQ(Coords::daysFromCivil(1500, 3, 1) - 1, Coords::daysFromCivil(1500, 2, 29)); // Julian leap year
+
+    int a_year, a_month, a_day;
+    Coords::civilFromDays(Coords::daysFromCivil(1582, 10, 10), a_year, a_month, a_day); // skipped
+    EXPECT_EQ(1582, a_year);
+    EXPECT_EQ(9, a_month);
+    EXPECT_EQ(30, a_day);
+  }
+
+  TEST(DayNumbers, ExtremeYears) {
+    const int years[] = {std::numeric_limits<int>::max(), std::numeric_limits<int>::min(),
+			 -4000001, -4000000, 4000000};
+    const int months[] = {12, 1, 3, 2, 2};
+    const int days[] = {31, 1, 1, 29, 29}; // leap days, Julian then Gregorian
+
+    for (unsigned long i = 0; i < sizeof(years)/sizeof(years[0]); ++i) {
+      int a_year, a_month, a_day;
+      Coords::civilFromDays(Coords::daysFromCivil(years[i], months[i], days[i]), a_year, a_month, a_day);
+      EXPECT_EQ(years[i], a_year);
+      EXPECT_EQ(months[i], a_month);
+      EXPECT_EQ(days[i], a_day);
+    }
+
+    // a Julian era is 1461 days
+    EXPECT_EQ(1461, Coords::daysFromCivil(-4000001, 3, 1) - Coords::daysFromCivil(-4000005, 3, 1));
+    EXPECT_EQ(1461, Coords::daysFromCivil(std::numeric_limits<int>::min() + 4, 1, 1) -
+	      Coords::daysFromCivil(std::numeric_limits<int>::min(), 1, 1));
+
+    // and a Gregorian one 146097
+    EXPECT_EQ(146097, Coords::daysFromCivil(std::numeric_limits<int>::max(), 1, 1) -
+	      Coords::daysFromCivil(std::numeric_limits<int>::max() - 400, 1, 1));
+  }
+
+  TEST(DayNumbers, Columns) {
+    const int years[] = {1970, 2000, 1582, 1582, -4712, 2016};
+    const int months[] = {1, 1, 10, 10, 1, 2};
+    const int days[] = {1, 1, 15, 4, 1, 29};
+    const unsigned long size(sizeof(years)/sizeof(years[0]));
+
+    long long day_numbers[size];
+    Coords::daysFromCivil(years, months, days, day_numbers, size);
+
+    int a_year[size], a_month[size], a_day[size];
+    Coords::civilFromDays(day_numbers, a_year, a_month, a_day, size);
+
+    for (unsigned long i = 0; i < size; ++i) {
+      EXPECT_EQ(Coords::daysFromCivil(years[i], months[i], days[i]), day_numbers[i]);
+      EXPECT_EQ(years[i], a_year[i]);
+      EXPECT_EQ(months[i], a_month[i]);
+      EXPECT_EQ(days[i], a_day[i]);
+    }
+  }
+
+  // Every day from Julian day number 0 to 9999-12-31 against the
+  // APC, NRC and Wikipedia Julian dates, each way. The DateTime
+  // constructor's Gregorian leap year rule rejects Julian leap days
+  // like 1500-02-29, so those are only checked here. The NRC inverse
+  // is Gregorian only. The Wikipedia inverse is not checked, it
+  // divides the Julian date as a double, not an integer, and is a day
+  // off from 1633-06-30 on.
+
+  TEST(DayNumbers, SameAsAPCNRCWiki) {
+
+    const long long first(Coords::daysFromCivil(-4712, 1, 1));
+    const long long last(Coords::daysFromCivil(9999, 12, 31));
+    const long long lilian(Coords::daysFromCivil(1582, 10, 15));
+
+    unsigned long checked(0);
+    unsigned long mismatches(0);
+    std::string first_mismatch;
+
+    int previous_year(-4713), previous_month(12), previous_day(31);
+
+    for (long long days = first; days <= last; ++days) {
+
+      int a_year, a_month, a_day;
+      Coords::civilFromDays(days, a_year, a_month, a_day);
+
+      // the next day, and back
+      bool same(Coords::daysFromCivil(a_year, a_month, a_day) == days);
+
+      if (a_day == 1)
+	same = same && (a_month == previous_month % 12 + 1) && previous_day >= 28 &&
+	  a_year == previous_year + (a_month == 1);
+      else
+	same = same && a_year == previous_year && a_month == previous_month &&
+	  (a_day == previous_day + 1 || (days == lilian && a_day == 15 && previous_day == 4));
+
+      previous_year = a_year;
+      previous_month = a_month;
+      previous_day = a_day;
+
+      const double jdn(days + 2440588.0);
+      const double mjd(days + 40587.0);
+
+      try {
+	const Coords::DateTime a(a_year, a_month, a_day);
+
+	same = same && a.toModifiedJulianDateAPC() == mjd;
+	same = same && a.toJulianDateWiki() == jdn;
+	same = same && a.toModifiedJulianDate() == mjd;
+
+	const Coords::DateTime b(a.fromModifiedJulianDateAPC(mjd));
+	same = same && b.year() == a_year && b.month() == a_month && b.day() == a_day;
+
+	if (days >= lilian) {
+	  const Coords::DateTime c(a.fromJulianDateNRC(jdn));
+	  same = same && c.year() == a_year && c.month() == a_month && c.day() == a_day;
+	}
+
+	++checked;
+      } catch (Coords::Error& err) {
+	same = same && a_month == 2 && a_day == 29 && a_year % 4 == 0;
+      }
+
+      try {
+	// NRC has no year 0, 1 BC is -1
+	const Coords::DateTime a(a_year > 0 ? a_year : a_year - 1, a_month, a_day);
+	same = same && floor(a.toJulianDateNRC()) == jdn;
+      } catch (Coords::Error& err) {
+	same = same && a_month == 2 && a_day == 29;
+      }
+
+      if (!same && mismatches++ == 0) {
+	std::stringstream date;
+	date << a_year << "-" << a_month << "-" << a_day << " (" << days << ")";
+	first_mismatch = date.str();
+      }
+    }
+
+    unsigned long julian_leap_days(0); // that are not Gregorian
+    for (int a_year = -4712; a_year < 1582; ++a_year)
+      if (a_year % 4 == 0 && !Coords::DateTime::leapYear(a_year))
+	++julian_leap_days;
+
+    EXPECT_EQ(last - first + 1 - julian_leap_days, checked);
+    EXPECT_EQ(0, mismatches) << "first at " << first_mismatch;
+  }
+
+  class RandomDayNumbers : public ::testing::Test {
+    // Creates new random dates each test.
+  protected:
+
+    virtual void SetUp() {
+      seed = std::chrono::system_clock::now().time_since_epoch().count();
+      generator.seed(seed);
+    }
+
+    virtual void TearDown() {}
+
+    // members
+
+    unsigned int seed;
+    std::default_random_engine generator;
+
+  };
+
+  TEST_F(RandomDayNumbers, SameAsAPC) {
+    std::uniform_real_distribution<double> mjd(-2400000, 2900000);
+
+    for (int i = 0; i < 100000; ++i) {
+
+      const double jdays(mjd(generator));
+
+      // APC rounds jdays + 2400001 to the next day within ~1e-10 of midnight
+      if (floor(jdays + 2400001.0) != floor(jdays) + 2400001.0)
+	continue;
+
+      try {
+	const Coords::DateTime a;
+	const Coords::DateTime expected(a.fromModifiedJulianDateAPC(jdays));
+	const Coords::DateTime actual(a.fromModifiedJulianDate(jdays));
+
+	EXPECT_EQ(expected.year(), actual.year()) << jdays << " seed " << seed;
+	EXPECT_EQ(expected.month(), actual.month()) << jdays << " seed " << seed;
+	EXPECT_EQ(expected.day(), actual.day()) << jdays << " seed " << seed;
+	EXPECT_EQ(expected.hour(), actual.hour()) << jdays << " seed " << seed;
+	EXPECT_EQ(expected.minute(), actual.minute()) << jdays << " seed " << seed;
+	EXPECT_EQ(expected.second(), actual.second()) << jdays << " seed " << seed;
+
+	EXPECT_EQ(expected.toModifiedJulianDateAPC(), actual.toModifiedJulianDate()) << jdays << " seed " << seed;
+
+      } catch (Coords::Error& err) {
+	// a Julian leap day, see DayNumbers.SameAsAPCNRCWiki
+      }
+    }
+  }
+
+  class RandomISO8601 : public ::testing::Test {
+    // Creates new random strings each test.
+  protected:
+
+    virtual void SetUp() {
+      seed = std::chrono::system_clock::now().time_since_epoch().count();
+      generator.seed(seed);
+    }
+
+    virtual void TearDown() {}
+
+    // members
+
+    unsigned int seed;
+    std::default_random_engine generator;
+
+  };
+
+  TEST_F(RandomISO8601, SameAsRegex) {
+    // mutates good strings with the grammar's own characters
+    const std::string alphabet("0123456789-+:.TzZ 1203");
+    const char* strings[] = {"2016-02-29T23:59:59.999+12:00", "-0001-11-30T00:00:00Z",
+			     "1582-10-15T00:00:00-0930", "0-01-01T00:00:00"};
+
+    std::uniform_int_distribution<unsigned long> which(0, sizeof(strings)/sizeof(strings[0]) - 1);
+    std::uniform_int_distribution<unsigned long> letter(0, alphabet.size() - 1);
+    std::uniform_int_distribution<int> edit(0, 3);
+
+    for (int i = 0; i < 20000; ++i) {
+
+      std::string a_string(strings[which(generator)]);
+
+      for (int j = edit(generator); j >= 0; --j) {
+	std::uniform_int_distribution<unsigned long> where(0, a_string.size());
+	const unsigned long k(where(generator));
+	const char c(alphabet[letter(generator)]);
+	switch (edit(generator)) {
+	case 0: a_string.insert(k, 1, c); break;
+	case 1: if (k < a_string.size()) a_string.erase(k, 1); break;
+	default: if (k < a_string.size()) a_string[k] = c; break;
+	}
+      }
+
+      ASSERT_EQ(byRegex(a_string), byConstructor(a_string)) << "'" << a_string << "' seed " << seed;
+    }
+  }
+
+
+
 
 
 
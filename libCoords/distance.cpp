@@ -0,0 +1,266 @@
+// ==================================================================
+// Filename:    distance.cpp
+//
+// Description: Implements the chord, great circle and haversine
+//              distances.
+//
+//              The chord of each pair is one vectorized pass over
+//              the columns. The great circle distance adds a second
+//              vectorized pass for |b + a| and a scalar pass of atan2
+//              calls. libm trig is not vectorized without
+//              -ffast-math, which would change the results. Compiled
+//              with BATCHFLAGS (see the Makefile).
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coordinates is free software: you can redistribute it and/or
+//  modify it under the terms of the GNU General Public License as
+//  published by the Free Software Foundation, either version 3 of the
+//  License, or (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ==================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <angle.h>
+#include <angleArray.h>
+#include <Cartesian.h>
+#include <CartesianArray.h>
+#include <distance.h>
+
+// -------------------
+// ----- kernels -----
+// -------------------
+
+namespace {
+
+  const unsigned long s_block(256);              // elements per scratch block
+  const unsigned long s_parallel_pairs(1 << 20); // smallest matrix split over threads
+
+  void chord_kernel(const double& ax, const double& ay, const double& az,
+		    const double* bx, const double* by, const double* bz,
+		    double* result, const unsigned long& n) {
+    for (unsigned long j = 0; j < n; ++j) {
+      const double dx(bx[j] - ax);
+      const double dy(by[j] - ay);
+      const double dz(bz[j] - az);
+      result[j] = sqrt(dx*dx + dy*dy + dz*dz);
+    }
+  }
+
+  // h is sin^2(angle/2), which rounds a little past 1 near the
+  // antipode, so clamp it before the square roots.
+  inline double haversineAngle(const double& h) {
+    const double c(std::min(1.0, std::max(0.0, h)));
+    return 2*atan2(sqrt(c), sqrt(1 - c));
+  }
+
+  // |b - a| = 2 sin(angle/2) and |b + a| = 2 cos(angle/2), so the
+  // angle is 2 atan2 of the two, accurate near 0 and near the
+  // antipode where 2 asin(chord/2) loses half the digits. That needs
+  // unit vectors, so a is scaled to one here, once per row.
+  void greatCircle_kernel(const double& x, const double& y, const double& z,
+			  const double* bx, const double* by, const double* bz,
+			  double* result, const unsigned long& size) {
+
+    const double r(sqrt(x*x + y*y + z*z));
+    const double ax(x/r), ay(y/r), az(z/r);
+
+    double sum[s_block];
+
+    for (unsigned long begin = 0; begin < size; begin += s_block) {
+
+      const unsigned long n(std::min(s_block, size - begin));
+
+      chord_kernel(ax, ay, az, bx + begin, by + begin, bz + begin, result + begin, n);
+      chord_kernel(-ax, -ay, -az, bx + begin, by + begin, bz + begin, sum, n);
+
+      for (unsigned long j = 0; j < n; ++j)
+	result[begin + j] = 2*atan2(result[begin + j], sum[j]);
+
+    }
+  }
+
+  // rows [begin, end) of the a x b matrix
+  void matrix_rows(const Coords::CartesianArray& a, const Coords::CartesianArray& b,
+		   double* result, const bool& great_circle,
+		   const unsigned long& begin, const unsigned long& end) {
+    const unsigned long m(b.size());
+    for (unsigned long i = begin; i < end; ++i) {
+      double* row(result + i*m);
+      if (great_circle)
+	greatCircle_kernel(a.x()[i], a.y()[i], a.z()[i], b.x(), b.y(), b.z(), row, m);
+      else
+	chord_kernel(a.x()[i], a.y()[i], a.z()[i], b.x(), b.y(), b.z(), row, m);
+    }
+  }
+
+  void matrix(const Coords::CartesianArray& a, const Coords::CartesianArray& b,
+	      std::vector<double>& result, const bool& great_circle,
+	      const unsigned int& threads) {
+
+    const unsigned long n(a.size());
+    const unsigned long m(b.size());
+
+    result.resize(n*m);
+
+    unsigned long workers(threads);
+    if (workers == 0)
+      workers = n*m < s_parallel_pairs ? 1 : std::max(1u, std::thread::hardware_concurrency());
+    workers = std::min(workers, std::max(n, 1ul));
+
+    if (workers == 1) {
+      matrix_rows(a, b, result.data(), great_circle, 0, n);
+      return;
+    }
+
+    // contiguous bands of rows, the first n % workers one row longer
+    std::vector<std::thread> pool;
+    pool.reserve(workers); // push_back does not throw with a thread in hand
+    unsigned long begin(0);
+    for (unsigned long w = 0; w < workers; ++w) {
+      const unsigned long end(begin + n/workers + (w < n % workers ? 1 : 0));
+      try {
+	pool.push_back(std::thread(matrix_rows, std::cref(a), std::cref(b), result.data(),
+				   great_circle, begin, end));
+      } catch (const std::system_error&) {
+	// out of threads, this one does the rest of the rows
+	matrix_rows(a, b, result.data(), great_circle, begin, n);
+	break;
+      }
+      begin = end;
+    }
+
+    for (unsigned long w = 0; w < pool.size(); ++w)
+      pool[w].join();
+  }
+
+} // end anonymous namespace
+
+
+// ------------------------
+// ----- unit vectors -----
+// ------------------------
+
+void Coords::unitVectors(const double* latitudes, const double* longitudes, const unsigned long& size,
+			 Coords::CartesianArray& result) {
+
+  result.resize(size);
+
+  double lat_rad[s_block], lon_rad[s_block];
+
+  for (unsigned long begin = 0; begin < size; begin += s_block) {
+
+    const unsigned long n(std::min(s_block, size - begin));
+
+    Coords::deg2rad(latitudes + begin, lat_rad, n);
+    Coords::deg2rad(longitudes + begin, lon_rad, n);
+
+    double* x(result.x() + begin);
+    double* y(result.y() + begin);
+    double* z(result.z() + begin);
+
+    for (unsigned long i = 0; i < n; ++i) {
+      const double r_xy(cos(lat_rad[i])); // projection in the xy plane
+      z[i] = sin(lat_rad[i]);
+      x[i] = r_xy*cos(lon_rad[i]);
+      y[i] = r_xy*sin(lon_rad[i]);
+    }
+
+  }
+}
+
+// ---------------------------------
+// ----- one pair of positions -----
+// ---------------------------------
+
+double Coords::chordDistance(const Coords::Cartesian& a, const Coords::Cartesian& b) {
+  return (a - b).magnitude();
+}
+
+double Coords::greatCircleDistance(const Coords::Cartesian& a, const Coords::Cartesian& b) {
+  // atan2 is accurate near 0 and pi, unlike acos of the dot product
+  return atan2(Coords::cross(a, b).magnitude(), a*b);
+}
+
+double Coords::haversineDistance(const Coords::angle& lat1, const Coords::angle& lon1,
+				 const Coords::angle& lat2, const Coords::angle& lon2) {
+  const double s_lat(sin((lat2.radians() - lat1.radians())/2));
+  const double s_lon(sin((lon2.radians() - lon1.radians())/2));
+  const double h(s_lat*s_lat + cos(lat1.radians())*cos(lat2.radians())*s_lon*s_lon);
+  return haversineAngle(h);
+}
+
+// -----------------------
+// ----- one to many -----
+// -----------------------
+
+void Coords::chordDistance(const Coords::Cartesian& a, const Coords::CartesianArray& b,
+			   std::vector<double>& result) {
+  result.resize(b.size());
+  chord_kernel(a.x(), a.y(), a.z(), b.x(), b.y(), b.z(), result.data(), b.size());
+}
+
+void Coords::greatCircleDistance(const Coords::Cartesian& a, const Coords::CartesianArray& b,
+				 std::vector<double>& result) {
+  result.resize(b.size());
+  greatCircle_kernel(a.x(), a.y(), a.z(), b.x(), b.y(), b.z(), result.data(), b.size());
+}
+
+void Coords::haversineDistance(const Coords::angle& lat, const Coords::angle& lon,
+			       const double* latitudes, const double* longitudes,
+			       const unsigned long& size, std::vector<double>& result) {
+
+  result.resize(size);
+
+  const double lat_rad(lat.radians());
+  const double lon_rad(lon.radians());
+  const double cos_lat(cos(lat_rad));
+
+  double lat_i[s_block], lon_i[s_block];
+
+  for (unsigned long begin = 0; begin < size; begin += s_block) {
+
+    const unsigned long n(std::min(s_block, size - begin));
+
+    Coords::deg2rad(latitudes + begin, lat_i, n);
+    Coords::deg2rad(longitudes + begin, lon_i, n);
+
+    double* h(result.data() + begin);
+
+    for (unsigned long i = 0; i < n; ++i) {
+      const double s_lat(sin((lat_i[i] - lat_rad)/2));
+      const double s_lon(sin((lon_i[i] - lon_rad)/2));
+      const double hav(s_lat*s_lat + cos_lat*cos(lat_i[i])*s_lon*s_lon);
+      h[i] = haversineAngle(hav);
+    }
+
+  }
+}
+
+// ------------------------
+// ----- many to many -----
+// ------------------------
+
+void Coords::chordDistance(const Coords::CartesianArray& a, const Coords::CartesianArray& b,
+			   std::vector<double>& result, const unsigned int& threads) {
+  matrix(a, b, result, false, threads);
+}
+
+void Coords::greatCircleDistance(const Coords::CartesianArray& a, const Coords::CartesianArray& b,
+				 std::vector<double>& result, const unsigned int& threads) {
+  matrix(a, b, result, true, threads);
+}
@@ -0,0 +1,107 @@
+// ================================================================
+// Filename:    distance.h
+//
+// Description: This defines chord, great circle and haversine
+//              distances between directions on a sphere, one pair at
+//              a time, one to many and many to many, e.g. for site
+//              selection over tens of millions of pairs.
+//
+//              Distances are in radians on the unit sphere. Multiply
+//              by the radius for a length, e.g. with Re in km
+//
+//                Re * greatCircleDistance(keplers, booksinc)
+//
+//              is the distance along the surface of the earth and Re
+//              * chordDistance the straight line distance that
+//              example1.cpp computes with spherical and Cartesian.
+//
+//              The batch forms take unit vectors, e.g. from
+//              unitVectors(), in a CartesianArray. All of the trig
+//              is per point so the per pair work is the chord, which
+//              vectorizes, and one atan2 for the great circle
+//              distance. chord = 2 sin(angle/2) so ordering or
+//              thresholding by chord needs no trig at all.
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coords is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coords is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coords.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#pragma once
+
+#include <vector>
+
+#include <angle.h>
+#include <Cartesian.h>
+#include <CartesianArray.h>
+
+namespace Coords {
+
+  // ------------------------
+  // ----- unit vectors -----
+  // ------------------------
+
+  // Latitude and longitude columns in degrees to unit vectors, the
+  // same directions as Cartesian(spherical(1, Latitude(lat),
+  // angle(lon))).
+  void unitVectors(const double* latitudes, const double* longitudes, const unsigned long& size,
+		   CartesianArray& result);
+
+  // ---------------------------------
+  // ----- one pair of positions -----
+  // ---------------------------------
+
+  // |a - b|
+  double chordDistance(const Cartesian& a, const Cartesian& b);
+
+  // The angle between a and b in radians, any non-zero lengths.
+  double greatCircleDistance(const Cartesian& a, const Cartesian& b);
+
+  // The angle between two latitude, longitude pairs in radians.
+  double haversineDistance(const angle& lat1, const angle& lon1,
+			   const angle& lat2, const angle& lon2);
+
+  // -----------------------
+  // ----- one to many -----
+  // -----------------------
+
+  // result[i] is the distance from a to b[i]. For the great circle
+  // distance a is any non-zero length and b unit vectors.
+  void chordDistance(const Cartesian& a, const CartesianArray& b, std::vector<double>& result);
+  void greatCircleDistance(const Cartesian& a, const CartesianArray& b, std::vector<double>& result);
+
+  // result[i] is the haversine distance from (lat, lon) to
+  // (latitudes[i], longitudes[i]) in degrees.
+  void haversineDistance(const angle& lat, const angle& lon,
+			 const double* latitudes, const double* longitudes, const unsigned long& size,
+			 std::vector<double>& result);
+
+  // ------------------------
+  // ----- many to many -----
+  // ------------------------
+
+  // result[i*b.size() + j] is the distance from a[i] to b[j], row
+  // major. For the great circle distance a is any non-zero lengths
+  // and b unit vectors. Rows are split over threads, all hardware
+  // threads for a large matrix if threads is 0. For latitude and
+  // longitude columns use unitVectors() then greatCircleDistance(),
+  // the haversine distance of every pair.
+  void chordDistance(const CartesianArray& a, const CartesianArray& b, std::vector<double>& result,
+		     const unsigned int& threads = 0);
+  void greatCircleDistance(const CartesianArray& a, const CartesianArray& b, std::vector<double>& result,
+			   const unsigned int& threads = 0);
+
+} // end namespace Coords
@@ -0,0 +1,151 @@
+// ================================================================
+// Filename:    distance_benchmark.cpp
+// Description: Benchmarks of the chord, great circle and haversine
+//              distances against the spherical and Cartesian
+//              subtraction in example1.cpp.
+//
+//              Batch benchmarks are per call, one to s_size sites or
+//              s_size by s_size sites.
+//
+// Author:      L.R. McFarland, lrm@starbug.com
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coordinates is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#include <vector>
+
+#include <angle.h>
+#include <benchmark.h>
+#include <Cartesian.h>
+#include <CartesianArray.h>
+#include <distance.h>
+#include <spherical.h>
+
+namespace {
+
+  using Coords::benchmark::doNotOptimize;
+
+  // ----------------
+  // ----- data -----
+  // ----------------
+
+  const unsigned long s_size(1024);
+
+  std::vector<double> latitudes() {
+    std::vector<double> a(s_size);
+    for (unsigned long i = 0; i < s_size; ++i)
+      a[i] = (i * 37 % 1800) * 0.1 - 90;
+    return a;
+  }
+
+  std::vector<double> longitudes() {
+    std::vector<double> a(s_size);
+    for (unsigned long i = 0; i < s_size; ++i)
+      a[i] = (i * 101 % 3600) * 0.1 - 180;
+    return a;
+  }
+
+  Coords::CartesianArray sites(const std::vector<double>& lat, const std::vector<double>& lon) {
+    Coords::CartesianArray a;
+    Coords::unitVectors(lat.data(), lon.data(), lat.size(), a);
+    return a;
+  }
+
+  const std::vector<double>    s_latitudes(latitudes());
+  const std::vector<double>    s_longitudes(longitudes());
+  const Coords::CartesianArray s_sites(sites(s_latitudes, s_longitudes));
+
+  // --------------------
+  // ----- one pair -----
+  // --------------------
+
+  // as example1.cpp
+  COORDS_BENCHMARK(spherical_difference_magnitude) {
+    Coords::spherical a(1, Coords::Latitude(37, 27, 13), Coords::angle(-122, 10, 55));
+    Coords::spherical b(1, Coords::Latitude(37, 23, 32.4852), Coords::angle(-122, 4, 46.2252));
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(a);
+      doNotOptimize(Coords::Cartesian(a - b).magnitude());
+    }
+  }
+
+  COORDS_BENCHMARK(haversineDistance) {
+    Coords::angle lat1(37, 27, 13), lon1(-122, 10, 55);
+    Coords::angle lat2(37, 23, 32.4852), lon2(-122, 4, 46.2252);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(lat1);
+      doNotOptimize(Coords::haversineDistance(lat1, lon1, lat2, lon2));
+    }
+  }
+
+  // -----------------------
+  // ----- one to many -----
+  // -----------------------
+
+  COORDS_BENCHMARK(haversineDistance_1024) {
+    std::vector<double> result;
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::haversineDistance(Coords::angle(10), Coords::angle(20),
+				s_latitudes.data(), s_longitudes.data(), s_size, result);
+      doNotOptimize(result[0]);
+    }
+  }
+
+  COORDS_BENCHMARK(greatCircleDistance_1024) {
+    std::vector<double> result;
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::greatCircleDistance(s_sites.get(0), s_sites, result);
+      doNotOptimize(result[0]);
+    }
+  }
+
+  COORDS_BENCHMARK(chordDistance_1024) {
+    std::vector<double> result;
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::chordDistance(s_sites.get(0), s_sites, result);
+      doNotOptimize(result[0]);
+    }
+  }
+
+  // ------------------------
+  // ----- many to many -----
+  // ------------------------
+
+  COORDS_BENCHMARK(greatCircleDistance_1024x1024_1_thread) {
+    std::vector<double> result;
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::greatCircleDistance(s_sites, s_sites, result, 1);
+      doNotOptimize(result[0]);
+    }
+  }
+
+  COORDS_BENCHMARK(greatCircleDistance_1024x1024) {
+    std::vector<double> result;
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::greatCircleDistance(s_sites, s_sites, result);
+      doNotOptimize(result[0]);
+    }
+  }
+
+  COORDS_BENCHMARK(chordDistance_1024x1024) {
+    std::vector<double> result;
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::chordDistance(s_sites, s_sites, result);
+      doNotOptimize(result[0]);
+    }
+  }
+
+} // end anonymous namespace
@@ -0,0 +1,263 @@
+// ================================================================
+// Filename:    distance_unittest.cpp
+// Description: This is the gtest unittest of the chord, great circle
+//              and haversine distances. The batch forms are checked
+//              against the single pair forms.
+//
+// Author:      L.R. McFarland, lrm@starbug.com
+// Created:     2026 Oct 16
+// Language:    C++
+//
+// See also: http://code.google.com/p/googletest/wiki/Primer
+//
+//  Coordinates is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <angle.h>
+#include <Cartesian.h>
+#include <CartesianArray.h>
+#include <distance.h>
+#include <spherical.h>
+
+
+namespace {
+
+  // ---------------------------
+  // ----- Fixed distances -----
+  // ---------------------------
+
+  TEST(FixedDistance, Example1) {
+    // keplers to books inc, as example1.cpp
+    const double Re(6371); // radius of earth in km
+
+    Coords::spherical keplers(Re, Coords::Latitude(37, 27, 13), Coords::angle(-122, 10, 55));
+    Coords::spherical booksinc(Re, Coords::Latitude(37, 23, 32.4852), Coords::angle(-122, 4, 46.2252));
+
+    Coords::Cartesian delta(keplers - booksinc);
+
+    EXPECT_NEAR(delta.magnitude(),
+		Re*Coords::chordDistance(Coords::Cartesian(keplers)/Re, Coords::Cartesian(booksinc)/Re),
+		1e-9);
+
+    double great_circle(Re*Coords::greatCircleDistance(Coords::Cartesian(keplers),
+							Coords::Cartesian(booksinc)));
+
+    double haversine(Re*Coords::haversineDistance(Coords::Latitude(37, 27, 13),
+						  Coords::angle(-122, 10, 55),
+						  Coords::Latitude(37, 23, 32.4852),
+						  Coords::angle(-122, 4, 46.2252)));
+
+    EXPECT_NEAR(great_circle, haversine, 1e-9);
+    EXPECT_GT(great_circle, delta.magnitude());      // arc longer than chord
+    EXPECT_NEAR(great_circle, delta.magnitude(), 1e-5); // but only just at 11 km
+  }
+
+  TEST(FixedDistance, UnitVectors) {
+    const double lat[] = {0, 90, -90, 0, 45};
+    const double lon[] = {0, 0, 0, 90, -180};
+
+    Coords::CartesianArray a;
+    Coords::unitVectors(lat, lon, 5, a);
+
+    ASSERT_EQ(5u, a.size());
+    for (unsigned int i = 0; i < a.size(); ++i) {
+      Coords::Cartesian expected(Coords::spherical(1, Coords::Latitude(lat[i]), Coords::angle(lon[i])));
+      EXPECT_NEAR(0, (expected - a.get(i)).magnitude(), 1e-15) << "point " << i;
+    }
+  }
+
+  TEST(FixedDistance, Antipodes) {
+    EXPECT_DOUBLE_EQ(M_PI, Coords::greatCircleDistance(Coords::Cartesian::Ux, -Coords::Cartesian::Ux));
+    EXPECT_DOUBLE_EQ(2, Coords::chordDistance(Coords::Cartesian::Uz, -Coords::Cartesian::Uz));
+
+    std::vector<Coords::Cartesian> points(1, -Coords::Cartesian::Uy);
+    std::vector<double> result;
+    Coords::greatCircleDistance(Coords::Cartesian::Uy, Coords::CartesianArray(points), result);
+    EXPECT_DOUBLE_EQ(M_PI, result[0]);
+
+    EXPECT_DOUBLE_EQ(M_PI, Coords::haversineDistance(Coords::angle(0), Coords::angle(0),
+						     Coords::angle(0), Coords::angle(180)));
+  }
+
+  TEST(FixedDistance, AntipodesAllLatitudes) {
+    // (lat, 0) to (-lat, 180), where sin^2 can round past 1
+    std::vector<double> latitudes, longitudes;
+    for (int i = -900; i <= 900; ++i) {
+      latitudes.push_back(-i/10.0);
+      longitudes.push_back(180);
+    }
+
+    for (unsigned long i = 0; i < latitudes.size(); ++i) {
+      SCOPED_TRACE(testing::Message() << "latitude " << -latitudes[i]);
+      EXPECT_NEAR(M_PI, Coords::haversineDistance(Coords::angle(-latitudes[i]), Coords::angle(0),
+						  Coords::angle(latitudes[i]), Coords::angle(180)), 1e-7);
+
+      std::vector<double> result;
+      Coords::haversineDistance(Coords::angle(-latitudes[i]), Coords::angle(0),
+				latitudes.data() + i, longitudes.data() + i, 1, result);
+      EXPECT_NEAR(M_PI, result[0], 1e-7);
+    }
+  }
+
+  TEST(FixedDistance, NonUnitCenter) {
+    std::vector<Coords::Cartesian> points;
+    points.push_back(Coords::Cartesian::Ux);
+    points.push_back(Coords::Cartesian::Uy);
+    points.push_back(-Coords::Cartesian::Ux);
+
+    const Coords::Cartesian a(2, 0, 0);
+    std::vector<double> result;
+    Coords::greatCircleDistance(a, Coords::CartesianArray(points), result);
+
+    for (unsigned long i = 0; i < points.size(); ++i)
+      EXPECT_DOUBLE_EQ(Coords::greatCircleDistance(a, points[i]), result[i]);
+    EXPECT_EQ(0, result[0]);
+
+    std::vector<Coords::Cartesian> centers(1, a);
+    std::vector<double> matrix;
+    Coords::greatCircleDistance(Coords::CartesianArray(centers), Coords::CartesianArray(points), matrix);
+    EXPECT_EQ(result, matrix);
+  }
+
+  TEST(FixedDistance, Empty) {
+    Coords::CartesianArray a, b(3);
+    std::vector<double> result(1);
+    Coords::greatCircleDistance(a, b, result);
+    EXPECT_TRUE(result.empty());
+    Coords::greatCircleDistance(b, a, result, 4);
+    EXPECT_TRUE(result.empty());
+  }
+
+  // ----------------------------
+  // ----- Random distances -----
+  // ----------------------------
+
+  class RandomDistance : public ::testing::Test {
+    // Creates new random sites each test.
+  protected:
+
+    virtual void SetUp() {
+
+      seed = std::chrono::system_clock::now().time_since_epoch().count();
+      size = 301;
+
+      std::default_random_engine generator(seed);
+      std::uniform_real_distribution<double> latitude(-90, 90);
+      std::uniform_real_distribution<double> longitude(-180, 180);
+
+      for (unsigned long i = 0; i < size; ++i) {
+	latitudes.push_back(latitude(generator));
+	longitudes.push_back(longitude(generator));
+      }
+
+      Coords::unitVectors(latitudes.data(), longitudes.data(), size, sites);
+    }
+
+    virtual void TearDown() {}
+
+    // members
+
+    unsigned int seed;
+    unsigned long size;
+
+    std::vector<double> latitudes;
+    std::vector<double> longitudes;
+    Coords::CartesianArray sites;
+
+  };
+
+  TEST_F(RandomDistance, OneToMany) {
+    std::vector<double> chord, great_circle, haversine;
+
+    Coords::chordDistance(sites.get(0), sites, chord);
+    Coords::greatCircleDistance(sites.get(0), sites, great_circle);
+
+    Coords::angle lat, lon;
+    lat.degrees(latitudes[0]);
+    lon.degrees(longitudes[0]);
+    Coords::haversineDistance(lat, lon, latitudes.data(), longitudes.data(), size, haversine);
+
+    ASSERT_EQ(size, chord.size());
+    ASSERT_EQ(size, great_circle.size());
+    ASSERT_EQ(size, haversine.size());
+
+    for (unsigned long i = 0; i < size; ++i) {
+
+      EXPECT_EQ(Coords::chordDistance(sites.get(0), sites.get(i)), chord[i]) << "seed " << seed;
+
+      EXPECT_NEAR(Coords::greatCircleDistance(sites.get(0), sites.get(i)), great_circle[i], 1e-14)
+	<< "seed " << seed;
+
+      Coords::angle lat_i, lon_i;
+      lat_i.degrees(latitudes[i]);
+      lon_i.degrees(longitudes[i]);
+      EXPECT_EQ(Coords::haversineDistance(lat, lon, lat_i, lon_i), haversine[i]) << "seed " << seed;
+
+      EXPECT_NEAR(great_circle[i], haversine[i], 1e-14) << "seed " << seed;
+    }
+  }
+
+  TEST_F(RandomDistance, ManyToMany) {
+    std::vector<double> chord, great_circle;
+
+    Coords::chordDistance(sites, sites, chord);
+    Coords::greatCircleDistance(sites, sites, great_circle);
+
+    ASSERT_EQ(size*size, chord.size());
+
+    for (unsigned long i = 0; i < size; ++i) {
+      std::vector<double> row;
+      Coords::greatCircleDistance(sites.get(i), sites, row);
+      for (unsigned long j = 0; j < size; ++j) {
+	EXPECT_EQ(Coords::chordDistance(sites.get(i), sites.get(j)), chord[i*size + j]);
+	EXPECT_EQ(row[j], great_circle[i*size + j]);
+      }
+    }
+  }
+
+  TEST_F(RandomDistance, Threads) {
+    std::vector<double> one, seven, automatic;
+
+    Coords::greatCircleDistance(sites, sites, one, 1);
+    Coords::greatCircleDistance(sites, sites, seven, 7);
+    EXPECT_EQ(one, seven);
+
+    // large enough to use every hardware thread
+    Coords::CartesianArray many;
+    for (unsigned int i = 0; i < 12; ++i)
+      for (unsigned long j = 0; j < size; ++j)
+	many.push_back(sites.get(j));
+
+    Coords::chordDistance(many, many, automatic);
+    Coords::chordDistance(many, many, one, 1);
+    EXPECT_EQ(one, automatic);
+  }
+
+} // end anonymous namespace
+
+
+// ==================
+// ===== main() =====
+// ==================
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
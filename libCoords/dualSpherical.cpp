@@ -0,0 +1,89 @@
+// ================================================================
+// Filename:    dualSpherical.cpp
+//
+// Description: Implements the conversions and scaling of
+//              dualSpherical.
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coords is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coords is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coords.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#include <angle.h>
+#include <Cartesian.h>
+#include <dualSpherical.h>
+#include <spherical.h>
+
+// -------------------------------
+// ----- class dualSpherical -----
+// -------------------------------
+
+const unsigned char Coords::dualSpherical::stale_spherical;
+const unsigned char Coords::dualSpherical::stale_cartesian;
+
+// ----- conversions -----
+
+void Coords::dualSpherical::updateSpherical() const {
+  m_spherical = Coords::spherical(m_cartesian);
+  m_stale = 0;
+}
+
+void Coords::dualSpherical::updateCartesian() const {
+  m_cartesian = Coords::Cartesian(m_spherical);
+  m_stale = 0;
+}
+
+// ----- in-place operators -----
+
+// scales whichever forms are current, neither needs a conversion.
+
+Coords::dualSpherical& Coords::dualSpherical::operator*=(const double& rhs) {
+  if ((m_stale & stale_spherical) == 0)
+    m_spherical *= rhs;
+  if ((m_stale & stale_cartesian) == 0)
+    m_cartesian *= rhs;
+  return *this;
+}
+
+Coords::dualSpherical& Coords::dualSpherical::operator/=(const double& rhs) {
+  if (rhs == 0)
+    throw DivideByZeroError();
+  if ((m_stale & stale_spherical) == 0)
+    m_spherical /= rhs;
+  if ((m_stale & stale_cartesian) == 0)
+    m_cartesian /= rhs;
+  return *this;
+}
+
+// ---------------------
+// ----- operators -----
+// ---------------------
+
+Coords::dualSpherical Coords::operator*(const Coords::dualSpherical& lhs, const double& rhs) {
+  Coords::dualSpherical product(lhs);
+  product *= rhs;
+  return product;
+}
+
+Coords::dualSpherical Coords::operator*(const double& lhs, const Coords::dualSpherical& rhs) {
+  return Coords::operator*(rhs, lhs);
+}
+
+Coords::dualSpherical Coords::operator/(const Coords::dualSpherical& lhs, const double& rhs) {
+  Coords::dualSpherical quotient(lhs);
+  quotient /= rhs;
+  return quotient;
+}
@@ -0,0 +1,160 @@
+// ================================================================
+// Filename:    dualSpherical.h
+//
+// Description: This defines a spherical coordinate that also keeps
+//              its Cartesian form. Each form is converted from the
+//              other only when it is read after the other changed,
+//              so a chain of additions and subtractions works in
+//              Cartesian and pays for one conversion back to r,
+//              theta and phi at the end, not for two Cartesian
+//              conversions and an atan2 pair per operator like
+//              spherical::operator+=.
+//
+//              A chain gives the same result as the Cartesian sum of
+//              the terms. That can differ from the same chain of
+//              spherical operators in the last bits, by the rounding
+//              of the round trips it skips.
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coords is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coords is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coords.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#pragma once
+
+#include <sstream>
+
+#include <angle.h>
+#include <Cartesian.h>
+#include <spherical.h>
+
+namespace Coords {
+
+  // -------------------------------
+  // ----- class dualSpherical -----
+  // -------------------------------
+
+  // The const accessors fill in the stale form so, as with
+  // cachedAngle, share a dualSpherical between threads only after
+  // both forms are current.
+  //
+  // All zeros is the origin with both forms current.
+
+  class dualSpherical {
+  public:
+
+    // ----- ctor and dtor -----
+
+    explicit dualSpherical(const double& r = 0.0,
+			   const angle& theta = angle(0.0),
+			   const angle& phi = angle(0.0))
+      : m_spherical(r, theta, phi), m_cartesian(), m_stale(stale_cartesian) {}
+
+    explicit dualSpherical(const spherical& a)
+      : m_spherical(a), m_cartesian(), m_stale(stale_cartesian) {}
+
+    explicit dualSpherical(const Cartesian& a)
+      : m_spherical(), m_cartesian(a), m_stale(stale_spherical) {}
+
+    // ----- accessors -----
+
+    const spherical& value() const {
+      if (m_stale & stale_spherical)
+	updateSpherical();
+      return m_spherical;
+    }
+
+    const Cartesian& cartesian() const {
+      if (m_stale & stale_cartesian)
+	updateCartesian();
+      return m_cartesian;
+    }
+
+    void          r(const double& rhs) {value(); m_spherical.r(rhs); m_stale = stale_cartesian;}
+    const double& r() const            {return value().r();}
+
+    void          theta(const angle& rhs) {value(); m_spherical.theta(rhs); m_stale = stale_cartesian;}
+    const angle&  theta() const           {return value().theta();}
+
+    void          phi(const angle& rhs) {value(); m_spherical.phi(rhs); m_stale = stale_cartesian;}
+    const angle&  phi() const           {return value().phi();}
+
+    // ----- bool operators -----
+
+    // as spherical::operator==, on r, theta and phi
+    bool operator==(const dualSpherical& rhs) const {return value() == rhs.value();}
+    bool operator!=(const dualSpherical& rhs) const {return !operator==(rhs);}
+
+    // ----- in-place operators -----
+
+    dualSpherical& operator+=(const dualSpherical& rhs) {
+      cartesian();
+      m_cartesian += rhs.cartesian();
+      m_stale = stale_spherical;
+      return *this;
+    }
+
+    dualSpherical& operator-=(const dualSpherical& rhs) {
+      cartesian();
+      m_cartesian -= rhs.cartesian();
+      m_stale = stale_spherical;
+      return *this;
+    }
+
+    dualSpherical& operator*=(const double& rhs); // scale
+    dualSpherical& operator/=(const double& rhs);
+
+  private:
+
+    static const unsigned char stale_spherical = 1;
+    static const unsigned char stale_cartesian = 2;
+
+    void updateSpherical() const;
+    void updateCartesian() const;
+
+    // ----- data members -----
+
+    mutable spherical     m_spherical;
+    mutable Cartesian     m_cartesian;
+    mutable unsigned char m_stale; // at most one stale_* bit
+
+  };
+
+  // ---------------------
+  // ----- operators -----
+  // ---------------------
+
+  inline dualSpherical operator+(const dualSpherical& lhs, const dualSpherical& rhs) {
+    return dualSpherical(lhs.cartesian() + rhs.cartesian());
+  }
+
+  inline dualSpherical operator-(const dualSpherical& lhs, const dualSpherical& rhs) {
+    return dualSpherical(lhs.cartesian() - rhs.cartesian());
+  }
+
+  dualSpherical operator*(const dualSpherical& lhs, const double& rhs); // scale
+  dualSpherical operator*(const double& lhs, const dualSpherical& rhs); // scale
+  dualSpherical operator/(const dualSpherical& lhs, const double& rhs); // scale
+
+  // -------------------------------
+  // ----- output operator<<() -----
+  // -------------------------------
+
+  inline std::ostream& operator<< (std::ostream& os, const Coords::dualSpherical& a) {
+    return os << a.value();
+  }
+
+} // end namespace Coords
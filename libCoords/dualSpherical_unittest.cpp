@@ -0,0 +1,207 @@
+// ================================================================
+// Filename:    dualSpherical_unittest.cpp
+// Description: This is the gtest unittest of dualSpherical. Results
+//              are checked against the same operations on spherical
+//              and Cartesian.
+//
+// Author:      L.R. McFarland, lrm@starbug.com
+// Created:     2026 Oct 16
+// Language:    C++
+//
+// See also: http://code.google.com/p/googletest/wiki/Primer
+//
+//  Coordinates is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#include <chrono>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <angle.h>
+#include <Cartesian.h>
+#include <dualSpherical.h>
+#include <spherical.h>
+
+
+namespace {
+
+  // -------------------------------
+  // ----- Fixed dualSpherical -----
+  // -------------------------------
+
+  TEST(FixedDualSpherical, Default) {
+    Coords::dualSpherical a;
+    EXPECT_EQ(Coords::spherical(), a.value());
+    EXPECT_EQ(Coords::Cartesian(), a.cartesian());
+  }
+
+  TEST(FixedDualSpherical, FromSpherical) {
+    Coords::spherical a(2, Coords::angle(30), Coords::angle(-45));
+    Coords::dualSpherical b(a);
+    EXPECT_EQ(a, b.value());
+    EXPECT_EQ(Coords::Cartesian(a), b.cartesian());
+    EXPECT_EQ(a, b.value());
+  }
+
+  TEST(FixedDualSpherical, FromCartesian) {
+    Coords::Cartesian a(1, -2, 3);
+    Coords::dualSpherical b(a);
+    EXPECT_EQ(a, b.cartesian());
+    EXPECT_EQ(Coords::spherical(a), b.value());
+    EXPECT_EQ(Coords::spherical(a).r(), b.r());
+  }
+
+  TEST(FixedDualSpherical, Accessors) {
+    Coords::dualSpherical a(Coords::Cartesian(0, 0, 1));
+    EXPECT_EQ(Coords::Cartesian(0, 0, 1), a.cartesian());
+
+    a.r(2);
+    EXPECT_EQ(2, a.r());
+    EXPECT_EQ(Coords::Cartesian(0, 0, 2), a.cartesian());
+
+    a.theta(Coords::angle(90));
+    EXPECT_EQ(90, a.theta().degrees());
+    EXPECT_EQ(Coords::Cartesian(Coords::spherical(2, Coords::angle(90), Coords::angle(0))),
+	      a.cartesian());
+
+    a.phi(Coords::angle(90));
+    EXPECT_EQ(90, a.phi().degrees());
+    EXPECT_EQ(Coords::Cartesian(Coords::spherical(2, Coords::angle(90), Coords::angle(90))),
+	      a.cartesian());
+  }
+
+  TEST(FixedDualSpherical, Add) {
+    Coords::spherical a(1, Coords::angle(10), Coords::angle(20));
+    Coords::spherical b(2, Coords::angle(-30), Coords::angle(40));
+
+    EXPECT_EQ(a + b, (Coords::dualSpherical(a) + Coords::dualSpherical(b)).value());
+
+    Coords::dualSpherical c(a);
+    c += Coords::dualSpherical(b);
+    EXPECT_EQ(a + b, c.value());
+  }
+
+  TEST(FixedDualSpherical, Subtract) {
+    Coords::spherical a(1, Coords::angle(10), Coords::angle(20));
+    Coords::spherical b(2, Coords::angle(-30), Coords::angle(40));
+
+    EXPECT_EQ(a - b, (Coords::dualSpherical(a) - Coords::dualSpherical(b)).value());
+
+    Coords::dualSpherical c(a);
+    c -= Coords::dualSpherical(b);
+    EXPECT_EQ(a - b, c.value());
+  }
+
+  TEST(FixedDualSpherical, Scale) {
+    Coords::spherical a(1.5, Coords::angle(10), Coords::angle(20));
+
+    Coords::dualSpherical b(a);
+    EXPECT_EQ(a*3, (b*3).value());
+    EXPECT_EQ(a*3, (3*b).value());
+    EXPECT_EQ(a/4, (b/4).value());
+
+    Coords::Cartesian c(1, 2, 3);
+    Coords::dualSpherical d(c);
+    d *= 2;
+    EXPECT_EQ(c*2, d.cartesian());
+    d /= 4;
+    EXPECT_EQ(c*2/4, d.cartesian());
+  }
+
+  TEST(FixedDualSpherical, DivideByZero) {
+    Coords::dualSpherical a(Coords::Cartesian(1, 2, 3));
+    EXPECT_THROW(a /= 0, Coords::DivideByZeroError);
+    EXPECT_THROW(a / 0, Coords::DivideByZeroError);
+  }
+
+  TEST(FixedDualSpherical, OutputOperator) {
+    Coords::dualSpherical a(1, Coords::angle(2), Coords::angle(3));
+    std::stringstream out;
+    out << a;
+    EXPECT_STREQ("<spherical><r>1</r><theta>2</theta><phi>3</phi></spherical>", out.str().c_str());
+  }
+
+  // --------------------------------
+  // ----- Random dualSpherical -----
+  // --------------------------------
+
+  class RandomDualSpherical : public ::testing::Test {
+    // Creates new random spherical terms each test.
+  protected:
+
+    virtual void SetUp() {
+
+      seed = std::chrono::system_clock::now().time_since_epoch().count();
+      size = 100;
+
+      std::default_random_engine generator(seed);
+      std::uniform_real_distribution<double> radius(0, 1e3);
+      std::uniform_real_distribution<double> degrees(-180, 180);
+
+      for (unsigned long i = 0; i < size; ++i)
+	terms.push_back(Coords::spherical(radius(generator),
+					  Coords::angle(degrees(generator)),
+					  Coords::angle(degrees(generator))));
+    }
+
+    virtual void TearDown() {}
+
+    // members
+
+    unsigned int seed;
+    unsigned long size;
+
+    std::vector<Coords::spherical> terms;
+
+  };
+
+  TEST_F(RandomDualSpherical, ChainIsCartesianSum) {
+    Coords::Cartesian cartesian_sum;
+    Coords::dualSpherical dual_sum;
+
+    for (unsigned long i = 0; i < size; ++i) {
+      cartesian_sum += Coords::Cartesian(terms[i]);
+      dual_sum += Coords::dualSpherical(terms[i]);
+    }
+
+    EXPECT_EQ(Coords::spherical(cartesian_sum), dual_sum.value()) << "seed " << seed;
+  }
+
+  TEST_F(RandomDualSpherical, ChainNearSpherical) {
+    Coords::spherical spherical_sum;
+    Coords::dualSpherical dual_sum;
+
+    for (unsigned long i = 0; i < size; ++i) {
+      spherical_sum += terms[i];
+      dual_sum += Coords::dualSpherical(terms[i]);
+    }
+
+    Coords::Cartesian delta(Coords::Cartesian(spherical_sum) - dual_sum.cartesian());
+    EXPECT_NEAR(0, delta.magnitude(), 1e-9*spherical_sum.r()) << "seed " << seed;
+  }
+
+} // end anonymous namespace
+
+
+// ==================
+// ===== main() =====
+// ==================
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,292 @@
+// ==================================================================
+// Filename:    fastTrig.cpp
+//
+// Description: Implements the polynomial sincos and atan2.
+//
+//              The coefficients are fdlibm's (k_sin.c, k_cos.c and
+//              s_atan.c, Sun Microsystems 1993). Each kernel computes
+//              both sides of its selects so gcc can if-convert the
+//              loops. Compiled with BATCHFLAGS -fno-trapping-math
+//              (see the Makefile) like angleArray.cpp.
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coordinates is free software: you can redistribute it and/or
+//  modify it under the terms of the GNU General Public License as
+//  published by the Free Software Foundation, either version 3 of the
+//  License, or (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ==================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <angle.h>
+#include <angleArray.h>
+#include <Cartesian.h>
+#include <CartesianArray.h>
+#include <fastTrig.h>
+#include <spherical.h>
+#include <sphericalArray.h>
+
+// -------------------
+// ----- kernels -----
+// -------------------
+
+namespace {
+
+  const unsigned long s_block(256); // elements per scratch block
+
+  const double s_round(6755399441055744.0); // 1.5 * 2^52, adding and subtracting rounds to nearest
+
+  // pi/2 in three 33 bit parts so k * part is exact for |k| < 2^20
+  const double s_2_pi(6.36619772367581382433e-01);
+  const double s_pio2_1(1.57079632673412561417e+00);
+  const double s_pio2_2(6.07710050630396597660e-11);
+  const double s_pio2_3(2.02226624871116645580e-21);
+
+  // sin(r) = r + r^3 (S1 + r^2 S2 + ...) on [-pi/4, pi/4]
+  const double S1(-1.66666666666666324348e-01);
+  const double S2( 8.33333333332248946124e-03);
+  const double S3(-1.98412698298579493134e-04);
+  const double S4( 2.75573137070700676789e-06);
+  const double S5(-2.50507602534068634195e-08);
+  const double S6( 1.58969099521155010221e-10);
+
+  // cos(r) = 1 - r^2/2 + r^4 (C1 + r^2 C2 + ...) on [-pi/4, pi/4]
+  const double C1( 4.16666666666666019037e-02);
+  const double C2(-1.38888888888741095749e-03);
+  const double C3( 2.48015872894767294178e-05);
+  const double C4(-2.75573143513906633035e-07);
+  const double C5( 2.08757232129817482790e-09);
+  const double C6(-1.13596475577881948265e-11);
+
+  // atan(u) = u - u (u^2 T0 + u^4 T1 + ...) on |u| < 7/16
+  const double T0( 3.33333333333329318027e-01);
+  const double T1(-1.99999999998764832476e-01);
+  const double T2( 1.42857142725034663711e-01);
+  const double T3(-1.11111104054623557880e-01);
+  const double T4( 9.09088713343650656196e-02);
+  const double T5(-7.69187620504482999495e-02);
+  const double T6( 6.66107313738753120669e-02);
+  const double T7(-5.83357013379057348645e-02);
+  const double T8( 4.97687799461593236017e-02);
+  const double T9(-3.65315727442169155270e-02);
+  const double T10(1.62858201153657823623e-02);
+
+  const double s_tan_pi_8(4.14213562373095034e-01);
+
+  // pi/4, pi/2 and pi as high and low parts
+  const double s_pio4_hi(7.85398163397448278999e-01);
+  const double s_pio4_lo(3.06161699786838301793e-17);
+  const double s_pio2_hi(1.57079632679489655800e+00);
+  const double s_pio2_lo(6.12323399573676603587e-17);
+  const double s_pi_hi(3.14159265358979311600e+00);
+  const double s_pi_lo(1.22464679914735320717e-16);
+
+  const double s_inf(std::numeric_limits<double>::infinity());
+
+  // |radians| < reduce_limit
+  inline void sincos_kernel(const double& x, double& s, double& c) {
+
+    // x = k pi/2 + r, |r| <= pi/4
+    const double k((x*s_2_pi + s_round) - s_round);
+    const double r(((x - k*s_pio2_1) - k*s_pio2_2) - k*s_pio2_3);
+
+    const double z(r*r);
+    const double sin_r(r + r*z*(S1 + z*(S2 + z*(S3 + z*(S4 + z*(S5 + z*S6))))));
+    const double cos_r((1 - 0.5*z) + z*z*(C1 + z*(C2 + z*(C3 + z*(C4 + z*(C5 + z*C6))))));
+
+    // quadrant k mod 4 as one of -2, -1, 0, 1, 2
+    const double q(k - 4*((k*0.25 + s_round) - s_round));
+
+    const double s_q(q*q == 1 ? cos_r : sin_r);
+    const double c_q(q*q == 1 ? sin_r : cos_r);
+
+    s = (q < 0 || q == 2) ? -s_q : s_q;
+    c = (q == 1 || q*q == 4) ? -c_q : c_q;
+  }
+
+  // finite x and y
+  inline double atan2_kernel(const double& y, const double& x) {
+
+    const double ax(fabs(x));
+    const double ay(fabs(y));
+
+    // t = min/max in [0, 1], then u = (t - 1)/(t + 1) above tan(pi/8)
+    const double lo(ay < ax ? ay : ax);
+    const double hi(ay < ax ? ax : ay);
+    const double t(lo/(hi == 0 ? 1.0 : hi));
+    const bool   big(t > s_tan_pi_8);
+    const double u((big ? t - 1 : t)/(big ? t + 1 : 1.0));
+
+    const double z(u*u);
+    const double w(z*z);
+    const double s1(z*(T0 + w*(T2 + w*(T4 + w*(T6 + w*(T8 + w*T10))))));
+    const double s2(w*(T1 + w*(T3 + w*(T5 + w*(T7 + w*T9)))));
+    const double atan_u(u - u*(s1 + s2));
+
+    double a(big ? s_pio4_hi + (s_pio4_lo + atan_u) : atan_u);
+    a = ay > ax ? (s_pio2_hi - a) + s_pio2_lo : a;
+    a = std::copysign(1.0, x) < 0 ? (s_pi_hi - a) + s_pi_lo : a; // signbit, which does not vectorize
+
+    return std::copysign(a, y);
+  }
+
+  // result may not be in
+  void sincos_block(const double* in, double* s, double* c, const unsigned long& n) {
+    for (unsigned long i = 0; i < n; ++i)
+      sincos_kernel(in[i], s[i], c[i]);
+
+    for (unsigned long i = 0; i < n; ++i)
+      if (!(fabs(in[i]) < Coords::fast::reduce_limit)) {
+	s[i] = sin(in[i]);
+	c[i] = cos(in[i]);
+      }
+  }
+
+  // result may not be y or x
+  void atan2_block(const double* y, const double* x, double* result, const unsigned long& n) {
+    for (unsigned long i = 0; i < n; ++i)
+      result[i] = atan2_kernel(y[i], x[i]);
+
+    for (unsigned long i = 0; i < n; ++i)
+      if (!(fabs(x[i]) < s_inf && fabs(y[i]) < s_inf))
+	result[i] = std::atan2(y[i], x[i]);
+  }
+
+} // end anonymous namespace
+
+
+const double Coords::fast::reduce_limit(1048576*s_pio2_1);
+
+// ------------------------
+// ----- trigonometry -----
+// ------------------------
+
+void Coords::fast::sincos(const double& radians, double& a_sin, double& a_cos) {
+  if (fabs(radians) < reduce_limit) {
+    sincos_kernel(radians, a_sin, a_cos);
+  } else {
+    a_sin = sin(radians);
+    a_cos = cos(radians);
+  }
+}
+
+double Coords::fast::atan2(const double& y, const double& x) {
+  if (fabs(x) < s_inf && fabs(y) < s_inf)
+    return atan2_kernel(y, x);
+  return std::atan2(y, x);
+}
+
+void Coords::fast::sincos(const double* radians, double* a_sin, double* a_cos, const unsigned long& size) {
+  double in[s_block];
+  for (unsigned long begin = 0; begin < size; begin += s_block) {
+    const unsigned long n(std::min(s_block, size - begin));
+    std::copy(radians + begin, radians + begin + n, in);
+    sincos_block(in, a_sin + begin, a_cos + begin, n);
+  }
+}
+
+void Coords::fast::atan2(const double* y, const double* x, double* result, const unsigned long& size) {
+  double y_in[s_block], x_in[s_block];
+  for (unsigned long begin = 0; begin < size; begin += s_block) {
+    const unsigned long n(std::min(s_block, size - begin));
+    std::copy(y + begin, y + begin + n, y_in);
+    std::copy(x + begin, x + begin + n, x_in);
+    atan2_block(y_in, x_in, result + begin, n);
+  }
+}
+
+// -----------------------
+// ----- conversions -----
+// -----------------------
+
+Coords::spherical Coords::fast::toSpherical(const Coords::Cartesian& a) {
+  // as spherical(const Cartesian&)
+  const double r_xy(sqrt(a.x()*a.x() + a.y()*a.y()));
+  return Coords::spherical(a.magnitude(),
+			   Coords::angle(Coords::angle::rad2deg(atan2(r_xy, a.z()))),
+			   Coords::angle(Coords::angle::rad2deg(atan2(a.y(), a.x()))));
+}
+
+void Coords::fast::toCartesian(const Coords::sphericalArray& a, Coords::CartesianArray& result) {
+
+  result.resize(a.size());
+
+  double theta_rad[s_block], sin_theta[s_block], cos_theta[s_block];
+  double phi_rad[s_block], sin_phi[s_block], cos_phi[s_block];
+
+  for (unsigned long begin = 0; begin < a.size(); begin += s_block) {
+
+    const unsigned long n(std::min(s_block, a.size() - begin));
+
+    Coords::deg2rad(a.theta() + begin, theta_rad, n);
+    Coords::deg2rad(a.phi() + begin, phi_rad, n);
+
+    sincos_block(theta_rad, sin_theta, cos_theta, n);
+    sincos_block(phi_rad, sin_phi, cos_phi, n);
+
+    const double* r(a.r() + begin);
+    double* x(result.x() + begin);
+    double* y(result.y() + begin);
+    double* z(result.z() + begin);
+
+    for (unsigned long i = 0; i < n; ++i) {
+      const double r_xy(r[i] * sin_theta[i]);
+      z[i] = r[i] * cos_theta[i];
+      y[i] = r_xy * sin_phi[i];
+      x[i] = r_xy * cos_phi[i];
+    }
+
+  }
+}
+
+void Coords::fast::toSpherical(const Coords::CartesianArray& a, Coords::sphericalArray& result) {
+
+  result.resize(a.size());
+
+  double r_xy[s_block], theta_rad[s_block], phi_rad[s_block];
+
+  for (unsigned long begin = 0; begin < a.size(); begin += s_block) {
+
+    const unsigned long n(std::min(s_block, a.size() - begin));
+
+    const double* x(a.x() + begin);
+    const double* y(a.y() + begin);
+    const double* z(a.z() + begin);
+    double* r(result.r() + begin);
+
+    for (unsigned long i = 0; i < n; ++i) {
+      r[i] = sqrt(x[i]*x[i] + y[i]*y[i] + z[i]*z[i]);
+      r_xy[i] = sqrt(x[i]*x[i] + y[i]*y[i]);
+    }
+
+    atan2_block(y, x, phi_rad, n);
+    atan2_block(r_xy, z, theta_rad, n);
+
+    Coords::rad2deg(phi_rad, result.phi() + begin, n);
+    Coords::rad2deg(theta_rad, result.theta() + begin, n);
+
+  }
+}
+
+// -----------------------------
+// ----- rotation matrices -----
+// -----------------------------
+
+Coords::rotation Coords::fast::rotationMatrix(const Coords::Cartesian& an_axis, const Coords::angle& an_angle) {
+  double s, c;
+  sincos(an_angle.radians(), s, c);
+  return Coords::rotation(an_axis, c, s);
+}
@@ -0,0 +1,117 @@
+// ================================================================
+// Filename:    fastTrig_benchmark.cpp
+// Description: Benchmarks of the polynomial batch sincos and atan2
+//              against the libm loops they replace.
+//
+//              Array benchmarks are per call over s_size arguments.
+//              The conversions built on them are in
+//              spherical_benchmark.cpp.
+//
+// Author:      L.R. McFarland, lrm@starbug.com
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coordinates is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#include <cmath>
+#include <vector>
+
+#include <benchmark.h>
+#include <fastTrig.h>
+
+namespace {
+
+  using Coords::benchmark::doNotOptimize;
+
+  // ----------------
+  // ----- data -----
+  // ----------------
+
+  const unsigned long s_size(4096);
+
+  // about 13 turns, both signs
+  std::vector<double> radians() {
+    std::vector<double> a(s_size);
+    for (unsigned long i = 0; i < s_size; ++i)
+      a[i] = i * 0.0397 - 81.3;
+    return a;
+  }
+
+  // all four quadrants
+  std::vector<double> ordinates() {
+    std::vector<double> a(s_size);
+    for (unsigned long i = 0; i < s_size; ++i)
+      a[i] = sin(i * 0.37) * (i % 5 + 0.5);
+    return a;
+  }
+
+  std::vector<double> abscissas() {
+    std::vector<double> a(s_size);
+    for (unsigned long i = 0; i < s_size; ++i)
+      a[i] = cos(i * 0.37) * (i % 3 + 0.25);
+    return a;
+  }
+
+  const std::vector<double> s_radians(radians());
+  const std::vector<double> s_y(ordinates());
+  const std::vector<double> s_x(abscissas());
+
+  // ------------------
+  // ----- sincos -----
+  // ------------------
+
+  COORDS_BENCHMARK(libm_sincos_loop_4096) {
+    std::vector<double> a_sin(s_size), a_cos(s_size);
+    for (unsigned long i = 0; i < count; ++i) {
+      for (unsigned long j = 0; j < s_size; ++j) {
+	a_sin[j] = sin(s_radians[j]);
+	a_cos[j] = cos(s_radians[j]);
+      }
+      doNotOptimize(a_sin[0]);
+      doNotOptimize(a_cos[0]);
+    }
+  }
+
+  COORDS_BENCHMARK(fast_sincos_4096) {
+    std::vector<double> a_sin(s_size), a_cos(s_size);
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::fast::sincos(s_radians.data(), a_sin.data(), a_cos.data(), s_size);
+      doNotOptimize(a_sin[0]);
+      doNotOptimize(a_cos[0]);
+    }
+  }
+
+  // -----------------
+  // ----- atan2 -----
+  // -----------------
+
+  COORDS_BENCHMARK(libm_atan2_loop_4096) {
+    std::vector<double> result(s_size);
+    for (unsigned long i = 0; i < count; ++i) {
+      for (unsigned long j = 0; j < s_size; ++j)
+	result[j] = atan2(s_y[j], s_x[j]);
+      doNotOptimize(result[0]);
+    }
+  }
+
+  COORDS_BENCHMARK(fast_atan2_4096) {
+    std::vector<double> result(s_size);
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::fast::atan2(s_y.data(), s_x.data(), result.data(), s_size);
+      doNotOptimize(result[0]);
+    }
+  }
+
+} // end anonymous namespace
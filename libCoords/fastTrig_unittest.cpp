@@ -0,0 +1,257 @@
+// ================================================================
+// Filename:    fastTrig_unittest.cpp
+// Description: This is the gtest unittest of the polynomial sincos
+//              and atan2. The random tests report the largest error
+//              against libm and the exact conversions.
+//
+// Author:      L.R. McFarland, lrm@starbug.com
+// Created:     2026 Oct 16
+// Language:    C++
+//
+// See also: http://code.google.com/p/googletest/wiki/Primer
+//
+//  Coordinates is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <angle.h>
+#include <Cartesian.h>
+#include <CartesianArray.h>
+#include <fastTrig.h>
+#include <spherical.h>
+#include <sphericalArray.h>
+
+
+namespace {
+
+  // the documented maximum errors of fastTrig.h
+  const double s_sincos_error(4e-16);
+  const double s_atan2_error(9e-16);
+  const double s_cartesian_error(1e-15);
+  const double s_spherical_error(2e-13); // degrees
+
+  // --------------------------
+  // ----- Fixed fastTrig -----
+  // --------------------------
+
+  TEST(FixedFastTrig, SincosQuadrants) {
+    const double radians[] = {0, -0.0, M_PI/4, -M_PI/4, M_PI/2, -M_PI/2, 3*M_PI/4, M_PI, -M_PI,
+			      3*M_PI/2, 2*M_PI, 1e5, -1e5, 1e6};
+
+    for (unsigned int i = 0; i < sizeof(radians)/sizeof(radians[0]); ++i) {
+      double s, c;
+      Coords::fast::sincos(radians[i], s, c);
+      EXPECT_NEAR(sin(radians[i]), s, s_sincos_error) << radians[i];
+      EXPECT_NEAR(cos(radians[i]), c, s_sincos_error) << radians[i];
+    }
+
+    double s, c;
+    Coords::fast::sincos(0, s, c);
+    EXPECT_EQ(0, s);
+    EXPECT_EQ(1, c);
+  }
+
+  TEST(FixedFastTrig, SincosLibm) {
+    // beyond reduce_limit, inf and NaN
+    const double radians[] = {Coords::fast::reduce_limit, -1e7, 1e300,
+			      std::numeric_limits<double>::infinity(),
+			      std::numeric_limits<double>::quiet_NaN()};
+
+    double s[5], c[5];
+    Coords::fast::sincos(radians, s, c, 5);
+
+    for (unsigned int i = 0; i < 3; ++i) {
+      EXPECT_EQ(sin(radians[i]), s[i]);
+      EXPECT_EQ(cos(radians[i]), c[i]);
+    }
+
+    EXPECT_TRUE(std::isnan(s[3]));
+    EXPECT_TRUE(std::isnan(c[4]));
+  }
+
+  TEST(FixedFastTrig, Atan2Special) {
+    const double inf(std::numeric_limits<double>::infinity());
+    const double y[] = {0, -0.0, 0, -0.0, 1, -1, 1, 1, -1, 1, inf, 1, inf};
+    const double x[] = {0, 0, -0.0, -0.0, 0, 0, 1, -1, -1, inf, 1, -inf, -inf};
+
+    for (unsigned int i = 0; i < sizeof(y)/sizeof(y[0]); ++i) {
+      const double expected(atan2(y[i], x[i]));
+      const double result(Coords::fast::atan2(y[i], x[i]));
+      EXPECT_NEAR(expected, result, s_atan2_error) << "y " << y[i] << " x " << x[i];
+      EXPECT_EQ(std::signbit(expected), std::signbit(result)) << "y " << y[i] << " x " << x[i];
+    }
+
+    EXPECT_TRUE(std::isnan(Coords::fast::atan2(std::numeric_limits<double>::quiet_NaN(), 1)));
+  }
+
+  TEST(FixedFastTrig, RotationMatrix) {
+    Coords::Cartesian axis(1, 2, 3);
+    Coords::rotation exact(axis, Coords::angle(37));
+    Coords::rotation fast(Coords::fast::rotationMatrix(axis, Coords::angle(37)));
+
+    for (unsigned int i = 0; i < 3; ++i)
+      for (unsigned int j = 0; j < 3; ++j)
+	EXPECT_NEAR(exact(i, j), fast(i, j), 4*s_sincos_error);
+  }
+
+  TEST(FixedFastTrig, Conversions) {
+    Coords::spherical a(2, Coords::angle(30), Coords::angle(-120));
+    Coords::Cartesian b(a);
+
+    Coords::spherical c(Coords::fast::toSpherical(b));
+    EXPECT_DOUBLE_EQ(2, c.r());
+    EXPECT_NEAR(30, c.theta().degrees(), s_spherical_error);
+    EXPECT_NEAR(-120, c.phi().degrees(), s_spherical_error);
+  }
+
+  // ---------------------------
+  // ----- Random fastTrig -----
+  // ---------------------------
+
+  class RandomFastTrig : public ::testing::Test {
+    // Creates new random arguments each test.
+  protected:
+
+    virtual void SetUp() {
+      seed = std::chrono::system_clock::now().time_since_epoch().count();
+      generator.seed(seed);
+      size = 1000000;
+    }
+
+    virtual void TearDown() {}
+
+    // largest |a[i] - b[i]|
+    static double maxError(const double* a, const double* b, const unsigned long& n) {
+      double error(0);
+      for (unsigned long i = 0; i < n; ++i)
+	error = std::max(error, fabs(a[i] - b[i]));
+      return error;
+    }
+
+    // members
+
+    unsigned int seed;
+    unsigned long size;
+    std::default_random_engine generator;
+
+  };
+
+  TEST_F(RandomFastTrig, Sincos) {
+    std::uniform_real_distribution<double> small(-2*M_PI, 2*M_PI);
+    std::uniform_real_distribution<double> large(-1e5, 1e5);
+
+    std::vector<double> radians(size), s(size), c(size), exact_s(size), exact_c(size);
+    for (unsigned long i = 0; i < size; ++i) {
+      radians[i] = i % 2 ? small(generator) : large(generator);
+      exact_s[i] = sin(radians[i]);
+      exact_c[i] = cos(radians[i]);
+    }
+
+    Coords::fast::sincos(radians.data(), s.data(), c.data(), size);
+
+    const double sin_error(maxError(s.data(), exact_s.data(), size));
+    const double cos_error(maxError(c.data(), exact_c.data(), size));
+    std::cout << "fast::sincos max error sin " << sin_error << " cos " << cos_error << std::endl;
+
+    EXPECT_LE(sin_error, s_sincos_error) << "seed " << seed;
+    EXPECT_LE(cos_error, s_sincos_error) << "seed " << seed;
+
+    // batch and scalar are the same arithmetic
+    for (unsigned long i = 0; i < 1000; ++i) {
+      double a_sin, a_cos;
+      Coords::fast::sincos(radians[i], a_sin, a_cos);
+      EXPECT_EQ(a_sin, s[i]);
+      EXPECT_EQ(a_cos, c[i]);
+    }
+  }
+
+  TEST_F(RandomFastTrig, Atan2) {
+    std::normal_distribution<double> gaussian(0, 1);
+    std::uniform_real_distribution<double> exponent(-30, 30);
+
+    std::vector<double> y(size), x(size), result(size), exact(size);
+    for (unsigned long i = 0; i < size; ++i) {
+      y[i] = gaussian(generator)*pow(10, exponent(generator));
+      x[i] = gaussian(generator)*pow(10, exponent(generator));
+      exact[i] = atan2(y[i], x[i]);
+    }
+
+    Coords::fast::atan2(y.data(), x.data(), result.data(), size);
+
+    const double error(maxError(result.data(), exact.data(), size));
+    std::cout << "fast::atan2 max error " << error << std::endl;
+
+    EXPECT_LE(error, s_atan2_error) << "seed " << seed;
+
+    for (unsigned long i = 0; i < 1000; ++i)
+      EXPECT_EQ(Coords::fast::atan2(y[i], x[i]), result[i]);
+  }
+
+  TEST_F(RandomFastTrig, Conversions) {
+    std::uniform_real_distribution<double> theta(0, 180);
+    std::uniform_real_distribution<double> phi(-180, 180);
+
+    Coords::sphericalArray directions(size);
+    for (unsigned long i = 0; i < size; ++i)
+      directions.set(i, Coords::spherical(1, Coords::angle(theta(generator)), Coords::angle(phi(generator))));
+
+    Coords::CartesianArray exact, fast;
+    Coords::toCartesian(directions, exact);
+    Coords::fast::toCartesian(directions, fast);
+
+    const double cartesian_error(std::max(maxError(exact.x(), fast.x(), size),
+					  std::max(maxError(exact.y(), fast.y(), size),
+						   maxError(exact.z(), fast.z(), size))));
+
+    Coords::sphericalArray exact_back, fast_back;
+    Coords::toSpherical(exact, exact_back);
+    Coords::fast::toSpherical(exact, fast_back);
+
+    const double spherical_error(std::max(maxError(exact_back.theta(), fast_back.theta(), size),
+					  maxError(exact_back.phi(), fast_back.phi(), size)));
+
+    std::cout << "fast::toCartesian max error " << cartesian_error
+	      << ", fast::toSpherical max error " << spherical_error << " degrees" << std::endl;
+
+    EXPECT_LE(cartesian_error, s_cartesian_error) << "seed " << seed;
+    EXPECT_LE(spherical_error, s_spherical_error) << "seed " << seed;
+
+    // scalar form
+    for (unsigned long i = 0; i < 1000; ++i) {
+      Coords::spherical b(Coords::fast::toSpherical(exact.get(i)));
+      EXPECT_NEAR(fast_back.theta()[i], b.theta().degrees(), 1e-12);
+      EXPECT_NEAR(fast_back.phi()[i], b.phi().degrees(), 1e-12);
+    }
+  }
+
+} // end anonymous namespace
+
+
+// ==================
+// ===== main() =====
+// ==================
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
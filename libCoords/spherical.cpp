@@ -22,6 +22,8 @@
 //  along with Coords.  If not, see <http://www.gnu.org/licenses/>.
 // ================================================================
 
+#include <type_traits>
+
 #include <angle.h>
 #include <Cartesian.h>
 #include <spherical.h>
@@ -49,21 +51,13 @@ Coords::spherical::spherical(const Coords::Cartesian& a)
   theta(Coords::angle(Coords::angle::rad2deg(atan2(r_xy, a.z()))));
 }
 
-// ----- copy constructor -----
-Coords::spherical::spherical(const Coords::spherical& a) {
-  m_r     = a.r();
-  m_theta = a.theta();
-  m_phi   = a.phi();
-};
+// ----- trivially copyable -----
 
-// ----- copy assignment -----
-Coords::spherical& Coords::spherical::operator=(const Coords::spherical& rhs) {
-  if (this == &rhs) return *this;
-  m_r     = rhs.r();
-  m_theta = rhs.theta();
-  m_phi   = rhs.phi();
-  return *this;
-}
+static_assert(std::is_trivially_copyable<Coords::spherical>::value,
+	      "spherical must stay trivially copyable");
+
+static_assert(sizeof(Coords::spherical) == 3*sizeof(double),
+	      "spherical must be three packed doubles");
 
 // ----- bool operators -----
 
@@ -163,3 +157,15 @@ Coords::spherical Coords::operator/(const double& lhs,
     throw DivideByZeroError();
   return Coords::spherical(lhs / rhs.r(), rhs.theta(), rhs.phi());
 }
+
+// -----------------------------------
+// ----- conversion, cached trig -----
+// -----------------------------------
+
+Coords::Cartesian Coords::toCartesian(const double& r,
+				      const Coords::cachedAngle& theta,
+				      const Coords::cachedAngle& phi) {
+  // as Cartesian(const spherical&)
+  double r_xy(r * theta.sin());
+  return Coords::Cartesian(r_xy * phi.cos(), r_xy * phi.sin(), r * theta.cos());
+}
@@ -32,6 +32,7 @@
 namespace Coords {
 
   class angle;
+  class cachedAngle;
   class Cartesian;
 
   class spherical {
@@ -60,10 +61,8 @@ namespace Coords {
 		       const angle& phi = angle(0.0))
       : m_r(r), m_theta(Latitude::g_north_pole - lat.degrees()), m_phi(phi) {};
 
-    ~spherical() {};
-
-    spherical(const spherical& a);
-    spherical& operator=(const spherical& rhs);
+    // The compiler generated copy constructor, copy assignment and
+    // destructor keep spherical three trivially copyable doubles.
 
     // ----- accessors -----
 
@@ -131,6 +130,16 @@ namespace Coords {
   spherical operator/(const spherical& lhs, const double& rhs); // scale
   spherical operator/(const double& lhs, const spherical& rhs); // scale
 
+  // -----------------------------------
+  // ----- conversion, cached trig -----
+  // -----------------------------------
+
+  // Same as Cartesian(spherical(r, theta, phi)) with the sines and
+  // cosines from theta and phi's caches, e.g. for a fixed grid of
+  // angles converted at many radii.
+
+  Cartesian toCartesian(const double& r, const cachedAngle& theta, const cachedAngle& phi);
+
   // -------------------------------
   // ----- output operator<<() -----
   // -------------------------------
@@ -0,0 +1,185 @@
+// ==================================================================
+// Filename:    sphericalArray.cpp
+//
+// Description: Implements the sphericalArray class and the batch
+//              spherical <-> Cartesian conversions.
+//
+//              The columns are worked in blocks small enough to stay
+//              in L1 cache. Each block is one vectorized pass to
+//              radians, one scalar pass of sin and cos (or atan2)
+//              calls, which gcc pairs into a single sincos call, and
+//              one vectorized pass of products and square roots. libm
+//              trig is not vectorized without -ffast-math, which would
+//              change the results, so only the arithmetic passes use
+//              the SIMD lanes. Compiled with BATCHFLAGS (see the
+//              Makefile).
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coordinates is free software: you can redistribute it and/or
+//  modify it under the terms of the GNU General Public License as
+//  published by the Free Software Foundation, either version 3 of the
+//  License, or (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ==================================================================
+
+#include <algorithm>
+#include <cmath>
+
+#include <angle.h>
+#include <Cartesian.h>
+#include <CartesianArray.h>
+#include <spherical.h>
+#include <sphericalArray.h>
+
+// -------------------
+// ----- kernels -----
+// -------------------
+
+namespace {
+
+  const unsigned long s_block(256); // elements per block, 2 kB per scratch column
+
+  // same expression as angle::deg2rad and angle::rad2deg so the
+  // results are identical
+  void deg2rad_kernel(const double* deg, double* rad, const unsigned long& n) {
+    for (unsigned long i = 0; i < n; ++i)
+      rad[i] = deg[i]*M_PI/180.0;
+  }
+
+  void rad2deg_kernel(const double* rad, double* deg, const unsigned long& n) {
+    for (unsigned long i = 0; i < n; ++i)
+      deg[i] = rad[i]*180.0/M_PI;
+  }
+
+  void sincos_kernel(const double* a, double* s, double* c, const unsigned long& n) {
+    for (unsigned long i = 0; i < n; ++i) {
+      s[i] = sin(a[i]);
+      c[i] = cos(a[i]);
+    }
+  }
+
+  void toCartesian_block(const double* r, const double* theta, const double* phi,
+			 double* x, double* y, double* z, const unsigned long& n) {
+
+    double theta_rad[s_block], sin_theta[s_block], cos_theta[s_block];
+    double phi_rad[s_block], sin_phi[s_block], cos_phi[s_block];
+
+    deg2rad_kernel(theta, theta_rad, n);
+    deg2rad_kernel(phi, phi_rad, n);
+
+    sincos_kernel(theta_rad, sin_theta, cos_theta, n);
+    sincos_kernel(phi_rad, sin_phi, cos_phi, n);
+
+    for (unsigned long i = 0; i < n; ++i) {
+      // ASSUMES: theta is the angle between z and r and phi is the
+      // angle between x and r projected into the xy plane.
+      const double r_xy(r[i] * sin_theta[i]);
+      z[i] = r[i] * cos_theta[i];
+      y[i] = r_xy * sin_phi[i];
+      x[i] = r_xy * cos_phi[i];
+    }
+  }
+
+  void toSpherical_block(const double* x, const double* y, const double* z,
+			 double* r, double* theta, double* phi, const unsigned long& n) {
+
+    double r_xy[s_block], theta_rad[s_block], phi_rad[s_block];
+
+    for (unsigned long i = 0; i < n; ++i) {
+      r[i] = sqrt(x[i]*x[i] + y[i]*y[i] + z[i]*z[i]);
+      r_xy[i] = sqrt(x[i]*x[i] + y[i]*y[i]);
+    }
+
+    for (unsigned long i = 0; i < n; ++i) {
+      phi_rad[i] = atan2(y[i], x[i]);
+      theta_rad[i] = atan2(r_xy[i], z[i]);
+    }
+
+    rad2deg_kernel(phi_rad, phi, n);
+    rad2deg_kernel(theta_rad, theta, n);
+  }
+
+} // end anonymous namespace
+
+
+// --------------------------------
+// ----- class sphericalArray -----
+// --------------------------------
+
+Coords::sphericalArray::sphericalArray(const std::vector<Coords::spherical>& a)
+  : m_r(a.size()), m_theta(a.size()), m_phi(a.size()) {
+  for (unsigned long i = 0; i < a.size(); ++i)
+    set(i, a[i]);
+}
+
+Coords::spherical Coords::sphericalArray::get(const unsigned long& idx) const {
+  // set the degrees directly, the angle(double) constructor rounds
+  // through seconds
+  Coords::angle theta;
+  theta.degrees(m_theta[idx]);
+  Coords::angle phi;
+  phi.degrees(m_phi[idx]);
+  return Coords::spherical(m_r[idx], theta, phi);
+}
+
+void Coords::sphericalArray::resize(const unsigned long& a_size) {
+  m_r.resize(a_size, 0.0);
+  m_theta.resize(a_size, 0.0);
+  m_phi.resize(a_size, 0.0);
+}
+
+void Coords::sphericalArray::reserve(const unsigned long& a_size) {
+  m_r.reserve(a_size);
+  m_theta.reserve(a_size);
+  m_phi.reserve(a_size);
+}
+
+void Coords::sphericalArray::clear() {
+  m_r.clear();
+  m_theta.clear();
+  m_phi.clear();
+}
+
+void Coords::sphericalArray::push_back(const Coords::spherical& a) {
+  m_r.push_back(a.r());
+  m_theta.push_back(a.theta().degrees());
+  m_phi.push_back(a.phi().degrees());
+}
+
+void Coords::sphericalArray::store(std::vector<Coords::spherical>& a) const {
+  a.resize(size());
+  for (unsigned long i = 0; i < size(); ++i)
+    a[i] = get(i);
+}
+
+// -----------------------------
+// ----- batch conversions -----
+// -----------------------------
+
+void Coords::toCartesian(const Coords::sphericalArray& a, Coords::CartesianArray& result) {
+  result.resize(a.size());
+  for (unsigned long i = 0; i < a.size(); i += s_block) {
+    const unsigned long n(std::min(s_block, a.size() - i));
+    toCartesian_block(a.r() + i, a.theta() + i, a.phi() + i,
+		      result.x() + i, result.y() + i, result.z() + i, n);
+  }
+}
+
+void Coords::toSpherical(const Coords::CartesianArray& a, Coords::sphericalArray& result) {
+  result.resize(a.size());
+  for (unsigned long i = 0; i < a.size(); i += s_block) {
+    const unsigned long n(std::min(s_block, a.size() - i));
+    toSpherical_block(a.x() + i, a.y() + i, a.z() + i,
+		      result.r() + i, result.theta() + i, result.phi() + i, n);
+  }
+}
@@ -0,0 +1,111 @@
+// ================================================================
+// Filename:    sphericalArray.h
+//
+// Description: This defines a structure of arrays container for
+//              spherical coordinates and batch conversions between
+//              sphericalArray and CartesianArray, e.g. for star
+//              catalogs. Angles are stored in degrees like
+//              Coords::angle.
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coords is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coords is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coords.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#pragma once
+
+#include <vector>
+
+#include <angle.h>
+#include <CartesianArray.h>
+#include <spherical.h>
+
+namespace Coords {
+
+  // --------------------------------
+  // ----- class sphericalArray -----
+  // --------------------------------
+
+  class sphericalArray {
+  public:
+
+    // ----- ctor and dtor -----
+
+    explicit sphericalArray(const unsigned long& a_size = 0) // zero filled
+      : m_r(a_size, 0.0), m_theta(a_size, 0.0), m_phi(a_size, 0.0) {};
+
+    explicit sphericalArray(const std::vector<spherical>& a); // load
+
+    ~sphericalArray() {};
+
+    // ----- accessors -----
+
+    unsigned long size() const  {return m_r.size();}
+    bool          empty() const {return m_r.empty();}
+
+    void resize(const unsigned long& a_size);
+    void reserve(const unsigned long& a_size);
+    void clear();
+
+    // columns, angles in degrees
+    double*       r()           {return m_r.data();}
+    const double* r() const     {return m_r.data();}
+
+    double*       theta()       {return m_theta.data();}
+    const double* theta() const {return m_theta.data();}
+
+    double*       phi()         {return m_phi.data();}
+    const double* phi() const   {return m_phi.data();}
+
+    // scalar load and store
+    spherical get(const unsigned long& idx) const;
+
+    void set(const unsigned long& idx, const spherical& a) {
+      m_r[idx] = a.r();
+      m_theta[idx] = a.theta().degrees();
+      m_phi[idx] = a.phi().degrees();
+    }
+
+    void push_back(const spherical& a);
+
+    void store(std::vector<spherical>& a) const;
+
+  private:
+
+    // ----- data members -----
+
+    std::vector<double> m_r, m_theta, m_phi;
+
+  };
+
+
+  // -----------------------------
+  // ----- batch conversions -----
+  // -----------------------------
+
+  // Batch versions of the Cartesian(const spherical&) and
+  // spherical(const Cartesian&) conversion constructors. The degree
+  // to radian step, the products and the square roots run as
+  // vectorized loops over blocks of the columns and each angle takes
+  // one sincos call. toCartesian matches the scalar conversion
+  // exactly. toSpherical skips the round trip through seconds in the
+  // angle constructor so it can differ from the scalar conversion in
+  // the last bit.
+
+  void toCartesian(const sphericalArray& a, CartesianArray& result);
+  void toSpherical(const CartesianArray& a, sphericalArray& result);
+
+} // end namespace Coords
@@ -0,0 +1,178 @@
+// ================================================================
+// Filename:    sphericalArray_unittest.cpp
+// Description: This is the gtest unittest of the sphericalArray batch
+//              conversions. Each conversion is checked against the
+//              scalar Cartesian and spherical conversion constructors.
+//
+// Author:      L.R. McFarland, lrm@starbug.com
+// Created:     2026 Oct 16
+// Language:    C++
+//
+// See also: http://code.google.com/p/googletest/wiki/Primer
+//
+//  Coordinates is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <angle.h>
+#include <Cartesian.h>
+#include <CartesianArray.h>
+#include <spherical.h>
+#include <sphericalArray.h>
+
+
+namespace {
+
+  // --------------------------------
+  // ----- Fixed sphericalArray -----
+  // --------------------------------
+
+  TEST(FixedSphericalArray, SizeConstructor) {
+    Coords::sphericalArray a(3);
+    EXPECT_EQ(3u, a.size());
+    for (unsigned long i = 0; i < a.size(); ++i)
+      EXPECT_EQ(Coords::spherical(), a.get(i));
+  }
+
+  TEST(FixedSphericalArray, LoadStore) {
+    std::vector<Coords::spherical> points;
+    points.push_back(Coords::spherical(1, Coords::angle(90), Coords::angle(0)));
+    points.push_back(Coords::spherical(2, Coords::angle(45), Coords::angle(-30)));
+
+    Coords::sphericalArray a(points);
+    EXPECT_EQ(2u, a.size());
+    EXPECT_EQ(points[1], a.get(1));
+
+    EXPECT_DOUBLE_EQ(2, a.r()[1]);
+    EXPECT_DOUBLE_EQ(45, a.theta()[1]);
+    EXPECT_DOUBLE_EQ(-30, a.phi()[1]);
+
+    a.push_back(Coords::spherical(3, Coords::angle(10), Coords::angle(20)));
+
+    std::vector<Coords::spherical> stored;
+    a.store(stored);
+    ASSERT_EQ(3u, stored.size());
+    EXPECT_EQ(points[0], stored[0]);
+    EXPECT_EQ(Coords::spherical(3, Coords::angle(10), Coords::angle(20)), stored[2]);
+  }
+
+  TEST(FixedSphericalArray, Axes) {
+    Coords::CartesianArray a;
+    a.push_back(Coords::Cartesian::Ux);
+    a.push_back(Coords::Cartesian::Uy);
+    a.push_back(Coords::Cartesian::Uz);
+
+    Coords::sphericalArray s;
+    Coords::toSpherical(a, s);
+    EXPECT_EQ(Coords::spherical(Coords::Cartesian::Ux), s.get(0));
+    EXPECT_EQ(Coords::spherical(Coords::Cartesian::Uy), s.get(1));
+    EXPECT_EQ(Coords::spherical(Coords::Cartesian::Uz), s.get(2));
+
+    Coords::CartesianArray c;
+    Coords::toCartesian(s, c);
+    EXPECT_EQ(3u, c.size());
+    for (unsigned long i = 0; i < c.size(); ++i)
+      EXPECT_EQ(Coords::Cartesian(s.get(i)), c.get(i));
+  }
+
+  // ---------------------------------
+  // ----- Random sphericalArray -----
+  // ---------------------------------
+
+  class RandomSphericalArray : public ::testing::Test {
+    // Creates new random points each test. The size is not a multiple
+    // of the conversion block to exercise the remainder.
+  protected:
+
+    virtual void SetUp() {
+
+      seed = std::chrono::system_clock::now().time_since_epoch().count();
+      lo = -1e3;
+      hi = 1e3;
+      size = 1027;
+
+      std::default_random_engine generator(seed);
+      std::uniform_real_distribution<double> distribution(lo, hi);
+
+      for (unsigned long i = 0; i < size; ++i)
+	points.push_back(Coords::Cartesian(distribution(generator),
+					   distribution(generator),
+					   distribution(generator)));
+    }
+
+    virtual void TearDown() {}
+
+    // members
+
+    unsigned int seed;
+    double lo;
+    double hi;
+    unsigned long size;
+
+    std::vector<Coords::Cartesian> points;
+
+  };
+
+  TEST_F(RandomSphericalArray, ToSpherical) {
+    Coords::sphericalArray result;
+    Coords::toSpherical(Coords::CartesianArray(points), result);
+    ASSERT_EQ(size, result.size());
+    for (unsigned long i = 0; i < size; ++i) {
+      Coords::spherical expected(points[i]);
+      EXPECT_EQ(expected.r(), result.r()[i]);
+      EXPECT_DOUBLE_EQ(expected.theta().degrees(), result.theta()[i]);
+      EXPECT_DOUBLE_EQ(expected.phi().degrees(), result.phi()[i]);
+    }
+  }
+
+  TEST_F(RandomSphericalArray, ToCartesian) {
+    Coords::sphericalArray s;
+    Coords::toSpherical(Coords::CartesianArray(points), s);
+
+    Coords::CartesianArray result;
+    Coords::toCartesian(s, result);
+    ASSERT_EQ(size, result.size());
+    for (unsigned long i = 0; i < size; ++i)
+      EXPECT_EQ(Coords::Cartesian(s.get(i)), result.get(i));
+  }
+
+  TEST_F(RandomSphericalArray, RoundTrip) {
+    Coords::sphericalArray s;
+    Coords::toSpherical(Coords::CartesianArray(points), s);
+
+    Coords::CartesianArray result;
+    Coords::toCartesian(s, result);
+    for (unsigned long i = 0; i < size; ++i) {
+      EXPECT_NEAR(points[i].x(), result.x()[i], 1e-9);
+      EXPECT_NEAR(points[i].y(), result.y()[i], 1e-9);
+      EXPECT_NEAR(points[i].z(), result.z()[i], 1e-9);
+    }
+  }
+
+} // end anonymous namespace
+
+
+// ==================
+// ===== main() =====
+// ==================
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
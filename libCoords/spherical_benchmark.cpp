@@ -0,0 +1,171 @@
+// ================================================================
+// Filename:    spherical_benchmark.cpp
+// Description: Benchmarks of the spherical <-> Cartesian conversions,
+//              scalar and batch, and spherical arithmetic.
+//
+//              Array benchmarks are per call over s_size points.
+//
+// Author:      L.R. McFarland, lrm@starbug.com
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coordinates is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#include <vector>
+
+#include <angle.h>
+#include <benchmark.h>
+#include <Cartesian.h>
+#include <CartesianArray.h>
+#include <dualSpherical.h>
+#include <fastTrig.h>
+#include <spherical.h>
+#include <sphericalArray.h>
+
+namespace {
+
+  using Coords::benchmark::doNotOptimize;
+
+  // ----------------
+  // ----- data -----
+  // ----------------
+
+  const unsigned long s_size(4096);
+
+  Coords::CartesianArray points() {
+    Coords::CartesianArray a(s_size);
+    for (unsigned long i = 0; i < s_size; ++i)
+      a.set(i, Coords::Cartesian(i + 1.0, 1.0/(i+1), 0.5*i - 1000));
+    return a;
+  }
+
+  const Coords::CartesianArray s_points(points());
+
+  const Coords::Cartesian s_a(1, 2, 3);
+  const Coords::spherical s_s(2, Coords::angle(30), Coords::angle(-120));
+
+  // ----------------------------
+  // ----- scalar spherical -----
+  // ----------------------------
+
+  COORDS_BENCHMARK(spherical_from_Cartesian) {
+    Coords::Cartesian a(s_a);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(a);
+      doNotOptimize(Coords::spherical(a));
+    }
+  }
+
+  COORDS_BENCHMARK(Cartesian_from_spherical) {
+    Coords::spherical s(s_s);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(s);
+      doNotOptimize(Coords::Cartesian(s));
+    }
+  }
+
+  COORDS_BENCHMARK(spherical_from_Cartesian_fast) {
+    Coords::Cartesian a(s_a);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(a);
+      doNotOptimize(Coords::fast::toSpherical(a));
+    }
+  }
+
+  COORDS_BENCHMARK(Cartesian_from_cached_angles) {
+    const Coords::cachedAngle theta(s_s.theta()), phi(s_s.phi());
+    double r(s_s.r());
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(r);
+      doNotOptimize(Coords::toCartesian(r, theta, phi));
+    }
+  }
+
+  COORDS_BENCHMARK(spherical_add) {
+    Coords::spherical s(s_s);
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(s);
+      doNotOptimize(s + s_s);
+    }
+  }
+
+  // ten additions, then r, theta and phi read once
+  COORDS_BENCHMARK(spherical_add_chain_10) {
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::spherical sum(s_s);
+      for (int j = 0; j < 10; ++j)
+	sum += s_s;
+      doNotOptimize(sum);
+    }
+  }
+
+  COORDS_BENCHMARK(dualSpherical_add_chain_10) {
+    const Coords::dualSpherical term(s_s);
+    term.cartesian();
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::dualSpherical sum(term);
+      for (int j = 0; j < 10; ++j)
+	sum += term;
+      doNotOptimize(sum.value());
+    }
+  }
+
+  COORDS_BENCHMARK(spherical_string_ctor) {
+    const std::string r("1.5"), theta("45"), phi("-30");
+    for (unsigned long i = 0; i < count; ++i)
+      doNotOptimize(Coords::spherical(r, theta, phi));
+  }
+
+  // --------------------------
+  // ----- sphericalArray -----
+  // --------------------------
+
+  COORDS_BENCHMARK(sphericalArray_toSpherical_4096) {
+    Coords::sphericalArray result(s_size);
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::toSpherical(s_points, result);
+      doNotOptimize(result.r()[0]);
+    }
+  }
+
+  COORDS_BENCHMARK(sphericalArray_toCartesian_4096) {
+    Coords::sphericalArray s(s_size);
+    Coords::toSpherical(s_points, s);
+    Coords::CartesianArray result(s_size);
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::toCartesian(s, result);
+      doNotOptimize(result.x()[0]);
+    }
+  }
+
+  COORDS_BENCHMARK(sphericalArray_toSpherical_4096_fast) {
+    Coords::sphericalArray result(s_size);
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::fast::toSpherical(s_points, result);
+      doNotOptimize(result.r()[0]);
+    }
+  }
+
+  COORDS_BENCHMARK(sphericalArray_toCartesian_4096_fast) {
+    Coords::sphericalArray s(s_size);
+    Coords::toSpherical(s_points, s);
+    Coords::CartesianArray result(s_size);
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::fast::toCartesian(s, result);
+      doNotOptimize(result.x()[0]);
+    }
+  }
+
+} // end anonymous namespace
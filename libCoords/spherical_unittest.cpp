@@ -30,6 +30,7 @@
 #include <chrono>
 #include <random>
 #include <sstream>
+#include <type_traits>
 
 #include <gtest/gtest.h>
 
@@ -62,6 +63,11 @@ namespace {
 
   }
 
+  TEST(FixedSpherical, TriviallyCopyable) {
+    EXPECT_TRUE(std::is_trivially_copyable<Coords::spherical>::value);
+    EXPECT_EQ(3*sizeof(double), sizeof(Coords::spherical));
+  }
+
   TEST(FixedSpace, OutputOperator) {
     Coords::spherical a(1, Coords::angle(2), Coords::angle(3));
     std::stringstream out;
@@ -581,6 +587,14 @@ namespace {
     }
   }
 
+  TEST(FixedSpherical, ToCartesianCachedAngles) {
+    const Coords::cachedAngle theta(62.5);
+    const Coords::cachedAngle phi(-143.25);
+    for (double r = 0.5; r < 1e6; r *= 10)
+      EXPECT_EQ(Coords::Cartesian(Coords::spherical(r, theta, phi)),
+		Coords::toCartesian(r, theta, phi));
+  }
+
 
 
 
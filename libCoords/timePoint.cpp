@@ -0,0 +1,210 @@
+// ==================================================================
+// Filename:    timePoint.cpp
+//
+// Description: Implements the compact time point.
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coordinates is free software: you can redistribute it and/or
+//  modify it under the terms of the GNU General Public License as
+//  published by the Free Software Foundation, either version 3 of the
+//  License, or (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ==================================================================
+
+#include <cmath>
+#include <type_traits>
+
+#include <timePoint.h>
+
+namespace {
+
+  inline long long floorDiv(const long long& a, const long long& b) {
+    return a >= 0 ? a/b : (a - b + 1)/b;
+  }
+
+  inline long long secondOfDay(const long long& a_seconds) {
+    return a_seconds - Coords::TimePoint::s_seconds_per_day*floorDiv(a_seconds, Coords::TimePoint::s_seconds_per_day);
+  }
+
+  inline long long offsetSeconds(const Coords::TimeZone& a_timezone) {
+    return llround(a_timezone.offset()*3600);
+  }
+
+} // end anonymous namespace
+
+
+// ---------------------
+// ----- TimePoint -----
+// ---------------------
+
+const long long Coords::TimePoint::s_seconds_per_day(86400);
+const double Coords::TimePoint::s_UnixEpoch(2440587.5);
+
+Coords::TimePoint::TimePoint(const long long& a_seconds,
+			     const double& a_fraction,
+			     const Coords::TimeZone& a_timezone)
+  : m_seconds(0),
+    m_fraction(0),
+    m_timezone(a_timezone)
+{
+  addSeconds(a_seconds, a_fraction);
+}
+
+Coords::TimePoint::TimePoint(const Coords::DateTime& a_datetime)
+  : m_seconds(0),
+    m_fraction(0),
+    m_timezone(a_datetime.timezone())
+{
+  // whole + (second - whole) is second again, bit for bit
+  const double whole(floor(a_datetime.second()));
+
+  m_seconds = s_seconds_per_day*Coords::daysFromCivil(a_datetime.year(), a_datetime.month(), a_datetime.day())
+    + 3600LL*a_datetime.hour() + 60LL*a_datetime.minute() + static_cast<long long>(whole)
+    - offsetSeconds(m_timezone);
+
+  m_fraction = a_datetime.second() - whole;
+}
+
+// ----- trivially copyable -----
+
+static_assert(std::is_trivially_copyable<Coords::TimePoint>::value,
+	      "TimePoint must stay trivially copyable");
+
+Coords::DateTime Coords::TimePoint::toDateTime() const {
+  int a_year, a_month, a_day, a_hour, a_minute;
+  double a_second;
+  fields(a_year, a_month, a_day, a_hour, a_minute, a_second);
+  return DateTime(a_year, a_month, a_day, a_hour, a_minute, a_second, m_timezone);
+}
+
+// ----- calendar fields -----
+
+long long Coords::TimePoint::localSeconds() const {
+  return m_seconds + offsetSeconds(m_timezone);
+}
+
+void Coords::TimePoint::fields(int& a_year, int& a_month, int& a_day,
+			       int& a_hour, int& a_minute, double& a_second) const {
+
+  const long long local(localSeconds());
+  const long long seconds(secondOfDay(local));
+
+  Coords::civilFromDays(floorDiv(local, s_seconds_per_day), a_year, a_month, a_day);
+
+  a_hour = seconds/3600;
+  a_minute = seconds/60 % 60;
+  a_second = seconds % 60 + m_fraction;
+}
+
+int Coords::TimePoint::year() const {
+  int a_year, a_month, a_day;
+  Coords::civilFromDays(floorDiv(localSeconds(), s_seconds_per_day), a_year, a_month, a_day);
+  return a_year;
+}
+
+int Coords::TimePoint::month() const {
+  int a_year, a_month, a_day;
+  Coords::civilFromDays(floorDiv(localSeconds(), s_seconds_per_day), a_year, a_month, a_day);
+  return a_month;
+}
+
+int Coords::TimePoint::day() const {
+  int a_year, a_month, a_day;
+  Coords::civilFromDays(floorDiv(localSeconds(), s_seconds_per_day), a_year, a_month, a_day);
+  return a_day;
+}
+
+int Coords::TimePoint::hour() const {
+  return secondOfDay(localSeconds())/3600;
+}
+
+int Coords::TimePoint::minute() const {
+  return secondOfDay(localSeconds())/60 % 60;
+}
+
+double Coords::TimePoint::second() const {
+  return secondOfDay(localSeconds()) % 60 + m_fraction;
+}
+
+double Coords::TimePoint::toJulianDate() const {
+  return (s_UnixEpoch + floorDiv(m_seconds, s_seconds_per_day))
+    + (secondOfDay(m_seconds) + m_fraction)/s_seconds_per_day;
+}
+
+// ----- in-place operators -----
+
+Coords::TimePoint& Coords::TimePoint::operator+=(const double& rhs_days) {
+  const double a_seconds(rhs_days*s_seconds_per_day);
+  const double whole(floor(a_seconds));
+  return addSeconds(static_cast<long long>(whole), a_seconds - whole);
+}
+
+Coords::TimePoint& Coords::TimePoint::operator-=(const double& rhs_days) {
+  return *this += -rhs_days;
+}
+
+Coords::TimePoint& Coords::TimePoint::addSeconds(const long long& a_seconds, const double& a_fraction) {
+
+  m_seconds += a_seconds;
+  m_fraction += a_fraction;
+
+  // back to [0, 1)
+  const double whole(floor(m_fraction));
+  if (whole != 0) {
+    m_seconds += static_cast<long long>(whole);
+    m_fraction -= whole;
+  }
+
+  if (m_fraction >= 1) { // a tiny negative fraction rounds up to 1
+    m_seconds += 1;
+    m_fraction -= 1;
+  }
+
+  return *this;
+}
+
+
+// +++++++++++++++++++++
+// +++++ operators +++++
+// +++++++++++++++++++++
+
+Coords::TimePoint Coords::operator+(const Coords::TimePoint& lhs, const double& rhs) {
+  Coords::TimePoint temp(lhs);
+  return temp += rhs;
+}
+
+Coords::TimePoint Coords::operator+(const double& lhs, const Coords::TimePoint& rhs) {
+  return rhs + lhs; // commute
+}
+
+Coords::TimePoint Coords::operator-(const Coords::TimePoint& lhs, const double& rhs) {
+  Coords::TimePoint temp(lhs);
+  return temp -= rhs;
+}
+
+double Coords::operator-(const Coords::TimePoint& lhs, const Coords::TimePoint& rhs) {
+  // returns difference in days
+  return ((lhs.seconds() - rhs.seconds()) + (lhs.fraction() - rhs.fraction()))/Coords::TimePoint::s_seconds_per_day;
+}
+
+bool Coords::operator==(const Coords::TimePoint& lhs, const Coords::TimePoint& rhs) {
+  return lhs.seconds() == rhs.seconds() && lhs.fraction() == rhs.fraction();
+}
+
+bool Coords::operator!=(const Coords::TimePoint& lhs, const Coords::TimePoint& rhs) {
+  return !(lhs == rhs);
+}
+
+bool Coords::operator<(const Coords::TimePoint& lhs, const Coords::TimePoint& rhs) {
+  return lhs.seconds() < rhs.seconds() || (lhs.seconds() == rhs.seconds() && lhs.fraction() < rhs.fraction());
+}
@@ -0,0 +1,145 @@
+// ================================================================
+// Filename:    timePoint.h
+//
+// Description: This defines a compact time point for time stepping
+//              loops, e.g. propagating an orbit a minute at a time.
+//
+//              A DateTime keeps its calendar fields, so each += goes
+//              to a Julian date and back to the calendar. A TimePoint
+//              keeps whole UTC seconds since the Unix epoch, an int64,
+//              and the fraction of a second, so += and -= are O(1)
+//              and do no calendar math. Calendar fields are computed
+//              only when asked for, in integer arithmetic, in the
+//              time point's time zone.
+//
+//              The calendar is the same as the DateTime Julian date
+//              methods, Julian before the Lilian date, 1582-10-15, and
+//              Gregorian on and after.
+//
+//              Conversion from a DateTime keeps the instant exactly,
+//              the fraction of a second bit for bit, and the TimeZone.
+//              Only the instant round-trips exactly. Converting back
+//              gives normalized calendar fields: hour 24, minute 60
+//              and second 60 carry into the next field, and the days
+//              skipped in 1582 come back as Julian dates. Time zone
+//              offsets are applied to the nearest second.
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coords is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coords is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coords.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#pragma once
+
+#include <datetime.h>
+
+namespace Coords {
+
+  // ---------------------
+  // ----- TimePoint -----
+  // ---------------------
+
+  class TimePoint {
+
+  public:
+
+    static const long long s_seconds_per_day;
+    static const double    s_UnixEpoch; // 1970-01-01T00:00:00Z as a Julian date
+
+    // ----- constructors -----
+
+    explicit TimePoint(const long long& a_seconds = 0, // Unix epoch
+		       const double& a_fraction = 0,
+		       const TimeZone& a_timezone = TimeZone(0));
+
+    explicit TimePoint(const DateTime& a_datetime);
+
+    // The compiler generated copy constructor, copy assignment and
+    // destructor keep TimePoint trivially copyable.
+
+    DateTime toDateTime() const;
+
+    // ----- accessors -----
+
+    const long long& seconds() const {return m_seconds;} // UTC, since the Unix epoch
+    const double& fraction() const {return m_fraction;} // of a second, [0, 1)
+
+    const TimeZone& timezone() const {return m_timezone;}
+
+    TimePoint inTimeZone(const TimeZone& a_new_timezone) const {
+      return TimePoint(m_seconds, m_fraction, a_new_timezone);}
+
+    // lazy calendar fields, in the time zone
+
+    int    year() const;
+    int    month() const;
+    int    day() const;
+    int    hour() const;
+    int    minute() const;
+    double second() const;
+
+    // all of them at once
+    void fields(int& a_year, int& a_month, int& a_day,
+		int& a_hour, int& a_minute, double& a_second) const;
+
+    double toJulianDate() const;
+
+    // ----- in-place operators -----
+
+    TimePoint& operator+=(const double& rhs_days);
+    TimePoint& operator-=(const double& rhs_days);
+
+    TimePoint& addSeconds(const long long& a_seconds, const double& a_fraction=0);
+
+  private:
+
+    long long localSeconds() const; // m_seconds in m_timezone
+
+    long long m_seconds;
+    double    m_fraction;
+
+    TimeZone  m_timezone;
+
+  };
+
+
+  // +++++++++++++++++++++
+  // +++++ operators +++++
+  // +++++++++++++++++++++
+
+  TimePoint operator+(const TimePoint& lhs, const double& rhs);
+  TimePoint operator+(const double& lhs, const TimePoint& rhs);
+
+  TimePoint operator-(const TimePoint& lhs, const double& rhs);
+
+  double operator-(const TimePoint& lhs, const TimePoint& rhs); // difference in days
+
+  // the same instant, in any time zone
+  bool operator==(const TimePoint& lhs, const TimePoint& rhs);
+  bool operator!=(const TimePoint& lhs, const TimePoint& rhs);
+  bool operator<(const TimePoint& lhs, const TimePoint& rhs);
+
+
+  // <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+  // <<<<< output operator<<() <<<<<
+  // <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+  // inline for boost. Use hpp instead?
+  inline std::ostream& operator<< (std::ostream& os, const Coords::TimePoint& a_timepoint) {
+    return os << a_timepoint.toDateTime();
+  }
+
+} // end namespace Coords
@@ -0,0 +1,89 @@
+// ================================================================
+// Filename:    timePoint_benchmark.cpp
+// Description: Benchmarks of the compact time point, against the
+//              same steps with DateTime in datetime_benchmark.cpp.
+//
+// Author:      L.R. McFarland, lrm@starbug.com
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coordinates is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#include <benchmark.h>
+#include <datetime.h>
+#include <timePoint.h>
+
+namespace {
+
+  using Coords::benchmark::doNotOptimize;
+
+  // not a global, the library's regex statics may not be built yet
+  const Coords::DateTime& datetime() {
+    static const Coords::DateTime s_datetime("2019-09-18T17:30:00.25-08:00");
+    return s_datetime;
+  }
+
+  // -----------------------
+  // ----- conversions -----
+  // -----------------------
+
+  COORDS_BENCHMARK(TimePoint_fromDateTime) {
+    for (unsigned long i = 0; i < count; ++i)
+      doNotOptimize(Coords::TimePoint(datetime()));
+  }
+
+  COORDS_BENCHMARK(TimePoint_toDateTime) {
+    const Coords::TimePoint a(datetime());
+    for (unsigned long i = 0; i < count; ++i)
+      doNotOptimize(a.toDateTime());
+  }
+
+  COORDS_BENCHMARK(TimePoint_toJulianDate) {
+    const Coords::TimePoint a(datetime());
+    for (unsigned long i = 0; i < count; ++i)
+      doNotOptimize(a.toJulianDate());
+  }
+
+  COORDS_BENCHMARK(TimePoint_fields) {
+    const Coords::TimePoint a(datetime());
+    int a_year, a_month, a_day, a_hour, a_minute;
+    double a_second;
+    for (unsigned long i = 0; i < count; ++i) {
+      a.fields(a_year, a_month, a_day, a_hour, a_minute, a_second);
+      doNotOptimize(a_second);
+    }
+  }
+
+  // ----------------------
+  // ----- time steps -----
+  // ----------------------
+
+  COORDS_BENCHMARK(TimePoint_add_days) {
+    Coords::TimePoint a(datetime());
+    for (unsigned long i = 0; i < count; ++i) {
+      a += 0.125;
+      doNotOptimize(a);
+    }
+  }
+
+  COORDS_BENCHMARK(TimePoint_add_seconds) {
+    Coords::TimePoint a(datetime());
+    for (unsigned long i = 0; i < count; ++i) {
+      a.addSeconds(60);
+      doNotOptimize(a);
+    }
+  }
+
+} // end anonymous namespace
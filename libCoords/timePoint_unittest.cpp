@@ -0,0 +1,263 @@
+// ================================================================
+// Filename:    timePoint_unittest.cpp
+// Description: This is the gtest unittest of the compact time point.
+//              Conversions are checked against DateTime, bit for bit,
+//              and Julian dates against the DateTime APC methods.
+//
+// Author:      L.R. McFarland, lrm@starbug.com
+// Created:     2026 Oct 16
+// Language:    C++
+//
+// See also: http://code.google.com/p/googletest/wiki/Primer
+//
+//  Coordinates is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#include <chrono>
+#include <random>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+
+#include <datetime.h>
+#include <timePoint.h>
+
+
+namespace {
+
+  void expectSame(const Coords::DateTime& expected, const Coords::DateTime& actual) {
+    EXPECT_EQ(expected.year(), actual.year());
+    EXPECT_EQ(expected.month(), actual.month());
+    EXPECT_EQ(expected.day(), actual.day());
+    EXPECT_EQ(expected.hour(), actual.hour());
+    EXPECT_EQ(expected.minute(), actual.minute());
+    EXPECT_EQ(expected.second(), actual.second());
+    EXPECT_EQ(expected.timezone().isLocal(), actual.timezone().isLocal());
+    EXPECT_EQ(expected.timezone().isZulu(), actual.timezone().isZulu());
+    EXPECT_EQ(expected.timezone().hasColon(), actual.timezone().hasColon());
+    EXPECT_EQ(expected.offset(), actual.offset());
+  }
+
+  // ---------------------------
+  // ----- Fixed TimePoint -----
+  // ---------------------------
+
+  TEST(FixedTimePoint, TriviallyCopyable) {
+    EXPECT_TRUE(std::is_trivially_copyable<Coords::TimeZone>::value);
+    EXPECT_TRUE(std::is_trivially_copyable<Coords::TimePoint>::value);
+  }
+
+  TEST(FixedTimePoint, UnixEpoch) {
+    const Coords::TimePoint a;
+    EXPECT_EQ(0, a.seconds());
+    EXPECT_EQ(0, a.fraction());
+    EXPECT_EQ(Coords::TimePoint::s_UnixEpoch, a.toJulianDate());
+    expectSame(Coords::DateTime("1970-01-01T00:00:00Z"), a.toDateTime());
+  }
+
+  TEST(FixedTimePoint, J2000) {
+    const Coords::TimePoint a(Coords::DateTime("2000-01-01T12:00:00Z"));
+    EXPECT_EQ(946728000, a.seconds());
+    EXPECT_EQ(Coords::DateTime::s_J2000, a.toJulianDate());
+  }
+
+  TEST(FixedTimePoint, LilianDate) {
+    Coords::TimePoint a(Coords::DateTime("1582-10-15T00:00:00"));
+    EXPECT_EQ(Coords::DateTime::s_LilianDate, a.toJulianDate());
+
+    a -= 1; // the Julian calendar's last day
+    EXPECT_EQ(1582, a.year());
+    EXPECT_EQ(10, a.month());
+    EXPECT_EQ(4, a.day());
+  }
+
+  TEST(FixedTimePoint, BeforeTheEpoch) {
+    const Coords::DateTime a_datetime("-0044-03-15T12:34:56.78");
+    const Coords::TimePoint a(a_datetime);
+    EXPECT_NEAR(a_datetime.toJulianDate(), a.toJulianDate(), 1e-8);
+    expectSame(a_datetime, a.toDateTime());
+  }
+
+  TEST(FixedTimePoint, Fields) {
+    const Coords::TimePoint a(Coords::DateTime("2014-12-07T12:34:56.78+05:30"));
+
+    EXPECT_EQ(2014, a.year());
+    EXPECT_EQ(12, a.month());
+    EXPECT_EQ(7, a.day());
+    EXPECT_EQ(12, a.hour());
+    EXPECT_EQ(34, a.minute());
+    EXPECT_EQ(56.78, a.second());
+
+    int a_year, a_month, a_day, a_hour, a_minute;
+    double a_second;
+    a.fields(a_year, a_month, a_day, a_hour, a_minute, a_second);
+
+    EXPECT_EQ(2014, a_year);
+    EXPECT_EQ(12, a_month);
+    EXPECT_EQ(7, a_day);
+    EXPECT_EQ(12, a_hour);
+    EXPECT_EQ(34, a_minute);
+    EXPECT_EQ(56.78, a_second);
+  }
+
+  TEST(FixedTimePoint, InTimeZone) {
+    const Coords::TimePoint a(Coords::DateTime("2014-12-07T02:34:56+05:30"));
+    const Coords::TimePoint b(a.inTimeZone(Coords::TimeZone("-08:00")));
+
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(6, b.day());
+    EXPECT_EQ(13, b.hour());
+    EXPECT_EQ(4, b.minute());
+    EXPECT_EQ(-8, b.timezone().offset());
+  }
+
+  TEST(FixedTimePoint, LeapDay) {
+    Coords::TimePoint a(Coords::DateTime("2016-02-28T12:00:00Z"));
+    a += 1;
+    expectSame(Coords::DateTime("2016-02-29T12:00:00Z"), a.toDateTime());
+    a += 1;
+    expectSame(Coords::DateTime("2016-03-01T12:00:00Z"), a.toDateTime());
+  }
+
+  TEST(FixedTimePoint, Arithmetic) {
+    const Coords::TimePoint a(Coords::DateTime("2019-12-31T23:59:59.5Z"));
+    const Coords::TimePoint b(a + 0.5/86400);
+
+    EXPECT_EQ(a.seconds() + 1, b.seconds());
+    EXPECT_EQ(0, b.fraction());
+    EXPECT_EQ(2020, b.year());
+    EXPECT_DOUBLE_EQ(0.5/86400, b - a);
+    EXPECT_TRUE(a < b);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(a, b - 0.5/86400);
+    EXPECT_EQ(b, 0.5/86400 + a);
+  }
+
+  TEST(FixedTimePoint, AddSeconds) {
+    Coords::TimePoint a(10, 0.25);
+    a.addSeconds(-3, -0.5);
+    EXPECT_EQ(6, a.seconds());
+    EXPECT_EQ(0.75, a.fraction());
+
+    a.addSeconds(0, -0.75 - 1e-20); // rounds to a fraction of 1
+    EXPECT_EQ(6, a.seconds());
+    EXPECT_EQ(0, a.fraction());
+  }
+
+  TEST(FixedTimePoint, Carry) {
+    const Coords::TimePoint a(Coords::DateTime(2019, 12, 31, 23, 59, 60.0, 0.0));
+    expectSame(Coords::DateTime("2020-01-01T00:00:00Z"), a.toDateTime());
+  }
+
+  TEST(FixedTimePoint, Output) {
+    const Coords::DateTime a_datetime("2014-12-07T12:34:56.7+0400");
+    std::stringstream expected, out;
+    expected << a_datetime;
+    out << Coords::TimePoint(a_datetime);
+    EXPECT_EQ(expected.str(), out.str());
+  }
+
+  // ----------------------------
+  // ----- Random TimePoint -----
+  // ----------------------------
+
+  class RandomTimePoint : public ::testing::Test {
+    // Creates new random date times each test.
+  protected:
+
+    virtual void SetUp() {
+      seed = std::chrono::system_clock::now().time_since_epoch().count();
+      generator.seed(seed);
+    }
+
+    virtual void TearDown() {}
+
+    // a valid DateTime, not in the days skipped in 1582
+    Coords::DateTime random() {
+      static const char* timezones[] = {"", "Z", "+05:30", "-0800", "12", "-12:00", "+0345"};
+
+      std::uniform_int_distribution<int> year(-4000, 4000);
+      std::uniform_int_distribution<int> month(1, 12);
+      std::uniform_int_distribution<int> day(1, 31);
+      std::uniform_int_distribution<int> hour(0, 23);
+      std::uniform_int_distribution<int> minute(0, 59);
+      std::uniform_real_distribution<double> second(0, 60);
+      std::uniform_int_distribution<int> timezone(0, sizeof(timezones)/sizeof(timezones[0]) - 1);
+
+      while (true) {
+	const int a_year(year(generator));
+	const int a_month(month(generator));
+	const int a_day(day(generator));
+	if (a_year == 1582 && a_month == 10 && a_day > 4 && a_day < 15)
+	  continue;
+	try {
+	  return Coords::DateTime(a_year, a_month, a_day, hour(generator), minute(generator),
+				  second(generator), Coords::TimeZone(timezones[timezone(generator)]));
+	} catch (Coords::Error& err) {
+	  // day out of range, try again
+	}
+      }
+    }
+
+    // members
+
+    unsigned int seed;
+    std::default_random_engine generator;
+
+  };
+
+  TEST_F(RandomTimePoint, RoundTrip) {
+    for (int i = 0; i < 100000; ++i) {
+      const Coords::DateTime a(random());
+      SCOPED_TRACE(testing::Message() << a << " seed " << seed);
+      expectSame(a, Coords::TimePoint(a).toDateTime());
+    }
+  }
+
+  TEST_F(RandomTimePoint, JulianDate) {
+    for (int i = 0; i < 100000; ++i) {
+      const Coords::DateTime a(random());
+      EXPECT_NEAR(a.toJulianDate(), Coords::TimePoint(a).toJulianDate(), 1e-8) << a << " seed " << seed;
+    }
+  }
+
+  TEST_F(RandomTimePoint, Stepping) {
+    std::uniform_real_distribution<double> step(-1, 1);
+
+    for (int i = 0; i < 100; ++i) {
+      const Coords::TimePoint start(random());
+      const double days(step(generator));
+
+      Coords::TimePoint a(start);
+      for (int j = 0; j < 1000; ++j)
+	a += days;
+
+      EXPECT_NEAR(1000*days, a - start, 1e-9) << "seed " << seed;
+      EXPECT_NEAR(start.toJulianDate() + 1000*days, a.toJulianDate(), 1e-8) << "seed " << seed;
+    }
+  }
+
+} // end anonymous namespace
+
+
+// ==================
+// ===== main() =====
+// ==================
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
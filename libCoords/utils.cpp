@@ -21,6 +21,8 @@
 // ================================================================
 
 #include <cmath>
+#include <cstdio> // snprintf
+#include <cstring>
 #include <iomanip> // for std::setw() and std::setfill()
 #include <stdlib.h> // strtod
 
@@ -115,27 +117,93 @@ double Coords::degrees2seconds(const double& a_deg, const double& a_min, const d
 
 }
 
+// --------------------------------
+// ----- parsing without NULs -----
+// --------------------------------
+
+namespace {
+
+  const long s_max_number(63); // longer numbers are not parsed
+
+} // end anonymous namespace
+
+bool Coords::parseDoubleSlow(const char* a_begin, const char* a_end, double& a_value) {
+
+  const long length(a_end - a_begin);
+  if (length == 0 || length > s_max_number)
+    return false;
+
+  char buffer[s_max_number + 1];
+  memcpy(buffer, a_begin, length);
+  buffer[length] = 0;
+
+  char* parsed;
+  const double value(strtod(buffer, &parsed));
+  if (parsed != buffer + length)
+    return false;
+
+  a_value = value;
+  return true;
+}
+
+bool Coords::parseDouble(const char* a_begin, const char* a_end, double& a_value) {
+
+  while (a_begin < a_end && isSpace(*a_begin))
+    ++a_begin;
+
+  while (a_begin < a_end && isSpace(a_end[-1]))
+    --a_end;
+
+  const char* p(a_begin);
+
+  bool isNegative(false);
+  if (p < a_end && (*p == '-' || *p == '+'))
+    isNegative = *p++ == '-';
+
+  double value;
+  if (parseDecimal(p, a_end, value) && p == a_end) {
+    a_value = isNegative ? -value : value;
+    return true;
+  }
+
+  // e.g. inf, nan or hex
+  return parseDoubleSlow(a_begin, a_end, a_value);
+}
+
+
 // -----------------------------
 // ----- output operator<< -----
 // -----------------------------
 
-void Coords::degrees2DMSString(const double& a_degrees, std::stringstream& a_string) {
+namespace {
 
-  // output as degrees minutes seconds
+  // splits a_degrees into the whole degrees, with the sign, and the
+  // minutes and seconds the strings show
+  void splitDegrees(const double& a_degrees, double& degrees, double& minutes, double& seconds) {
 
-  bool isNegative(false);
+    bool isNegative(false);
+
+    if (a_degrees < 0)
+      isNegative = true;
+
+    degrees = fabs(a_degrees);
+    minutes = 60 * (degrees - floor(degrees));
+    seconds = 60 * (minutes - floor(minutes));
+
+    if (isNegative)
+      degrees = -1 * floor(degrees);
+    else
+      degrees = floor(degrees);
+  }
+
+} // end anonymous namespace
 
-  if (a_degrees < 0)
-    isNegative = true;
+void Coords::degrees2DMSString(const double& a_degrees, std::stringstream& a_string) {
 
-  double degrees = fabs(a_degrees);
-  double minutes = 60 * (degrees - floor(degrees));
-  double seconds = 60 * (minutes - floor(minutes));
+  // output as degrees minutes seconds
 
-  if (isNegative)
-    degrees = -1 * floor(degrees);
-  else
-    degrees = floor(degrees);
+  double degrees, minutes, seconds;
+  splitDegrees(a_degrees, degrees, minutes, seconds);
 
   a_string << degrees << "* " << floor(minutes) << "\' " << seconds << "\"";
 
@@ -145,19 +213,8 @@ void Coords::degrees2HMSString(const double& a_degrees, std::stringstream& a_str
 
   // output as time 00:00:00
 
-  bool isNegative(false);
-
-  if (a_degrees < 0)
-    isNegative = true;
-
-  double degrees = fabs(a_degrees);
-  double minutes = 60 * (degrees - floor(degrees));
-  double seconds = 60 * (minutes - floor(minutes));
-
-  if (isNegative)
-    degrees = -1 * floor(degrees);
-  else
-    degrees = floor(degrees);
+  double degrees, minutes, seconds;
+  splitDegrees(a_degrees, degrees, minutes, seconds);
 
   a_string << std::setw(2) << std::setfill('0') << degrees
 	   << ":"
@@ -166,3 +223,239 @@ void Coords::degrees2HMSString(const double& a_degrees, std::stringstream& a_str
 	   << std::setw(2) << std::setfill('0') << std::setw(4) << std::fixed << std::setprecision(1) << seconds;
 
 }
+
+// ----------------------------------
+// ----- output without streams -----
+// ----------------------------------
+
+// An ostream prints a double as printf("%g") with precision 6, or
+// printf("%.*f") after std::fixed. These write the same digits. The
+// value is m*2^e, so the digits are the integer m*10^d*2^e rounded
+// half to even, which is exact in 128 bits for d <= 17 and what
+// printf gives. Values outside the fast paths, e.g. NaN, inf or
+// exponents in %g, go to snprintf, which is still no allocation.
+
+namespace {
+
+  typedef unsigned __int128 uint128;
+
+  // 10^0 to 10^17
+  const unsigned long long s_powers_of_ten[] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+    10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+    100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+    100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+    100000000000000000ULL
+  };
+
+  // 10^-4 to 10^5, the %g exponents printed without one
+  const double s_decades[] = {1e-4, 1e-3, 1e-2, 1e-1, 1e0, 1e1, 1e2, 1e3, 1e4, 1e5};
+
+  const double s_two63(9223372036854775808.0); // 2^63, m*10^17 << e fits
+  const int s_field_size(16); // any one number these print, with the NUL
+
+  // a, finite and in [0, 2^63), times 10^decimals rounded to an
+  // integer, ties to even
+  uint128 scaleExact(const double& a, const int& decimals) {
+
+    // a is m*2^shift
+    unsigned long long bits;
+    memcpy(&bits, &a, sizeof(bits));
+    const int biased(static_cast<int>(bits >> 52));
+    const unsigned long long fraction(bits & 0xfffffffffffffULL);
+    const unsigned long long m(biased ? fraction | 0x10000000000000ULL : fraction);
+    const int shift((biased ? biased : 1) - 1075);
+    const uint128 product(static_cast<uint128>(m) * s_powers_of_ten[decimals]);
+
+    if (shift >= 0)
+      return product << shift;
+
+    const int k(-shift);
+    if (k >= 120)
+      return 0; // product < 2^110, under half
+
+    const uint128 q(product >> k);
+    const uint128 remainder(product - (q << k));
+    const uint128 half(static_cast<uint128>(1) << (k - 1));
+
+    if (remainder > half || (remainder == half && (q & 1)))
+      return q + 1;
+
+    return q;
+  }
+
+  // q as a decimal with the last decimals digits after the point
+  char* writeScaled(char* p, uint128 q, const int& decimals) {
+    char digits[48];
+    int n(0);
+
+    while (q >> 64) {
+      digits[n++] = '0' + static_cast<int>(q % 10);
+      q /= 10;
+    }
+
+    unsigned long long r(static_cast<unsigned long long>(q)); // 64 bit divides
+
+    do {
+      digits[n++] = '0' + static_cast<int>(r % 10);
+      r /= 10;
+    } while (r);
+
+    while (n <= decimals)
+      digits[n++] = '0';
+
+    while (n > decimals)
+      *p++ = digits[--n];
+
+    if (decimals) {
+      *p++ = '.';
+      while (n)
+	*p++ = digits[--n];
+    }
+
+    return p;
+  }
+
+  // printf("%.*f", decimals, x)
+  char* writeFixed(char* p, const double& x, const int& decimals) {
+    const double a(fabs(x));
+
+    if (!(a < s_two63) || decimals > 17)
+      return p + snprintf(p, s_field_size, "%.*f", decimals, x);
+
+    if (std::signbit(x))
+      *p++ = '-';
+
+    return writeScaled(p, scaleExact(a, decimals), decimals);
+  }
+
+  // printf("%g", x)
+  char* writeGeneral(char* p, const double& x) {
+    const double a(fabs(x));
+
+    if (a == 0) {
+      if (std::signbit(x))
+	*p++ = '-';
+      *p++ = '0';
+      return p;
+    }
+
+    if (a >= 1e-4 && a < 999999) {
+
+      // the exponent after rounding to 6 digits, one off at most
+      int exponent(5);
+      while (exponent > -4 && a < s_decades[exponent + 4])
+	--exponent;
+      uint128 q(scaleExact(a, 5 - exponent));
+
+      if (q >= 1000000)
+	q = scaleExact(a, 5 - ++exponent);
+      else if (q < 100000)
+	q = scaleExact(a, 5 - --exponent);
+
+      if (exponent >= -4 && exponent <= 5) {
+
+	if (std::signbit(x))
+	  *p++ = '-';
+
+	const int decimals(5 - exponent);
+	p = writeScaled(p, q, decimals);
+
+	// %g drops trailing zeros and a bare point
+	if (decimals) {
+	  while (p[-1] == '0')
+	    --p;
+	  if (p[-1] == '.')
+	    --p;
+	}
+
+	return p;
+      }
+    }
+
+    return p + snprintf(p, s_field_size, "%g", x);
+  }
+
+  // std::setw(width) with std::setfill('0'), right adjusted
+  char* pad(char* begin, char* end, const int& width) {
+    const int length(end - begin);
+    if (length >= width)
+      return end;
+    memmove(begin + width - length, begin, length);
+    memset(begin, '0', width - length);
+    return begin + width;
+  }
+
+  typedef unsigned long (*formatter)(const double&, char*);
+
+  unsigned long formatColumn(formatter a_format, const double* a_degrees, const unsigned long& a_size,
+			     char* a_buffer, const unsigned long& a_capacity,
+			     unsigned long& a_length, const char& a_separator) {
+    unsigned long row(0);
+    unsigned long length(0);
+
+    for (; row < a_size && a_capacity - length >= Coords::angle_string_size; ++row) {
+      length += a_format(a_degrees[row], a_buffer + length);
+      a_buffer[length++] = a_separator;
+    }
+
+    a_length = length;
+    return row;
+  }
+
+} // end anonymous namespace
+
+unsigned long Coords::double2String(const double& a_value, char* a_buffer) {
+  char* p(writeGeneral(a_buffer, a_value));
+  *p = 0;
+  return p - a_buffer;
+}
+
+unsigned long Coords::degrees2DMSString(const double& a_degrees, char* a_buffer) {
+
+  double degrees, minutes, seconds;
+  splitDegrees(a_degrees, degrees, minutes, seconds);
+
+  char* p(a_buffer);
+
+  p = writeGeneral(p, degrees);
+  *p++ = '*';
+  *p++ = ' ';
+  p = writeGeneral(p, floor(minutes));
+  *p++ = '\'';
+  *p++ = ' ';
+  p = writeGeneral(p, seconds);
+  *p++ = '"';
+  *p = 0;
+
+  return p - a_buffer;
+}
+
+unsigned long Coords::degrees2HMSString(const double& a_degrees, char* a_buffer) {
+
+  double degrees, minutes, seconds;
+  splitDegrees(a_degrees, degrees, minutes, seconds);
+
+  char* p(a_buffer);
+
+  p = pad(p, writeGeneral(p, degrees), 2);
+  *p++ = ':';
+  p = pad(p, writeGeneral(p, floor(minutes)), 2);
+  *p++ = ':';
+  p = pad(p, writeFixed(p, seconds, 1), 4);
+  *p = 0;
+
+  return p - a_buffer;
+}
+
+unsigned long Coords::degrees2DMSString(const double* a_degrees, const unsigned long& a_size,
+					char* a_buffer, const unsigned long& a_capacity,
+					unsigned long& a_length, const char& a_separator) {
+  return formatColumn(degrees2DMSString, a_degrees, a_size, a_buffer, a_capacity, a_length, a_separator);
+}
+
+unsigned long Coords::degrees2HMSString(const double* a_degrees, const unsigned long& a_size,
+					char* a_buffer, const unsigned long& a_capacity,
+					unsigned long& a_length, const char& a_separator) {
+  return formatColumn(degrees2HMSString, a_degrees, a_size, a_buffer, a_capacity, a_length, a_separator);
+}
@@ -49,8 +49,145 @@ namespace Coords {
 
   double degrees2seconds(const double& a_deg, const double& a_min, const double& a_sec);
 
+  // strtod of all of [a_begin, a_end), which need not be NUL
+  // terminated, without allocating. Leading and trailing white space
+  // is allowed. Returns false, leaving a_value unchanged, if the range
+  // is not one number.
+  bool parseDouble(const char* a_begin, const char* a_end, double& a_value);
+
+  // the C locale's, without the locale
+  inline bool isDigit(const char& c) {
+    return c >= '0' && c <= '9';
+  }
+
+  inline bool isSpace(const char& c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+  }
+
+  // The Clinger fast path: up to 19 digits of mantissa times or
+  // divided by an exact power of ten is one rounding, the same as
+  // strtod. Other numbers, e.g. long mantissas or large exponents, are
+  // copied to the stack for strtod by parseDoubleSlow().
+
+  // 10^0 to 10^22 are exact doubles
+  const double exact_powers_of_ten[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+  };
+
+  const int max_exact_power(22);
+  const unsigned long long max_exact_mantissa(9007199254740992ULL); // 2^53
+  const int max_mantissa_digits(19); // fits an unsigned long long
+
+  // strtod of all of [a_begin, a_end), at most 63 chars
+  bool parseDoubleSlow(const char* a_begin, const char* a_end, double& a_value);
+
+  // Reads an unsigned digits[.digits][e[+|-]digits] at a_next into
+  // a_value, as strtod would, and moves a_next past it. At least one
+  // digit is needed on either side of the point. The exponent is read
+  // only if a_exponent. Returns false, leaving both unchanged, if
+  // there is no number at a_next. Inline in the header so the field
+  // loops of the parsers compile to straight line code.
+  inline bool parseDecimal(const char*& a_next, const char* a_end, double& a_value,
+			   const bool& a_exponent=true) {
+
+    const char* p(a_next);
+    unsigned long long mantissa(0);
+    int digits(0);
+    int exponent(0);
+    bool truncated(false);
+    bool any(false);
+
+    for (; p < a_end && isDigit(*p); ++p) {
+      any = true;
+      if (digits < max_mantissa_digits) {
+	mantissa = 10*mantissa + (*p - '0');
+	if (mantissa)
+	  ++digits;
+      } else {
+	++exponent;
+	truncated = true;
+      }
+    }
+
+    if (p < a_end && *p == '.') {
+      ++p;
+      for (; p < a_end && isDigit(*p); ++p) {
+	any = true;
+	if (digits < max_mantissa_digits) {
+	  mantissa = 10*mantissa + (*p - '0');
+	  --exponent;
+	  if (mantissa)
+	    ++digits;
+	} else {
+	  truncated = true;
+	}
+      }
+    }
+
+    if (!any)
+      return false;
+
+    // an e without digits after it is not part of the number
+    if (a_exponent && p < a_end && (*p == 'e' || *p == 'E')) {
+      const char* q(p + 1);
+      bool isNegativeExponent(false);
+      if (q < a_end && (*q == '-' || *q == '+'))
+	isNegativeExponent = *q++ == '-';
+      if (q < a_end && isDigit(*q)) {
+	int e(0);
+	for (; q < a_end && isDigit(*q); ++q)
+	  if (e < 100000) // strtod has the last word on large ones
+	    e = 10*e + (*q - '0');
+	exponent += isNegativeExponent ? -e : e;
+	p = q;
+      }
+    }
+
+    if (!truncated && mantissa <= max_exact_mantissa &&
+	exponent >= -max_exact_power && exponent <= max_exact_power) {
+      a_value = exponent < 0 ?
+	mantissa/exact_powers_of_ten[-exponent] :
+	mantissa*exact_powers_of_ten[exponent];
+    } else if (!parseDoubleSlow(a_next, p, a_value)) {
+      return false;
+    }
+
+    a_next = p;
+    return true;
+  }
+
+  // The ostream default format of a_value, i.e. printf("%g"), to
+  // a_buffer with a NUL, without a stream. a_buffer must hold
+  // double_string_size chars. Returns the length, not counting the NUL.
+  const unsigned long double_string_size(16);
+
+  unsigned long double2String(const double& a_value, char* a_buffer);
+
   // output operator<<
   void degrees2DMSString(const double& a_degrees, std::stringstream& a_string);
   void degrees2HMSString(const double& a_degrees, std::stringstream& a_string);
 
+  // The same characters as the stringstream versions given a new
+  // stream, written to a_buffer with a NUL and without a stream,
+  // allocation or locale. a_buffer must hold angle_string_size
+  // chars. Returns the length, not counting the NUL.
+  const unsigned long angle_string_size(48);
+
+  unsigned long degrees2DMSString(const double& a_degrees, char* a_buffer);
+  unsigned long degrees2HMSString(const double& a_degrees, char* a_buffer);
+
+  // Columns of a_size angles, each followed by a_separator, e.g. for
+  // a table. Rows are written while a_capacity has room for
+  // angle_string_size more chars, so a_size*angle_string_size always
+  // holds all of them. a_length is set to the number of chars
+  // written, with no NUL. Returns the number of rows written.
+  unsigned long degrees2DMSString(const double* a_degrees, const unsigned long& a_size,
+				  char* a_buffer, const unsigned long& a_capacity,
+				  unsigned long& a_length, const char& a_separator='\n');
+
+  unsigned long degrees2HMSString(const double* a_degrees, const unsigned long& a_size,
+				  char* a_buffer, const unsigned long& a_capacity,
+				  unsigned long& a_length, const char& a_separator='\n');
+
 } // end namespace Coords
@@ -0,0 +1,276 @@
+// ==================================================================
+// Filename:    xmlRecords.cpp
+//
+// Description: Implements the XML record writer and pull parser.
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coordinates is free software: you can redistribute it and/or
+//  modify it under the terms of the GNU General Public License as
+//  published by the Free Software Foundation, either version 3 of the
+//  License, or (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ==================================================================
+
+#include <cstring>
+#include <sstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <angle.h>
+#include <xmlRecords.h>
+
+namespace {
+
+  // appends the literal a_tag
+  template <unsigned long N>
+  inline char* writeTag(char* p, const char (&a_tag)[N]) {
+    memcpy(p, a_tag, N - 1);
+    return p + N - 1;
+  }
+
+  inline char* writeValue(char* p, const double& a) {
+    return p + Coords::double2String(a, p);
+  }
+
+} // end anonymous namespace
+
+
+// ---------------------------------
+// ----- formatting to buffers -----
+// ---------------------------------
+
+unsigned long Coords::toXML(const Cartesian& a, char* a_buffer) {
+  char* p(a_buffer);
+  p = writeTag(p, "<Cartesian><x>");
+  p = writeValue(p, a.x());
+  p = writeTag(p, "</x><y>");
+  p = writeValue(p, a.y());
+  p = writeTag(p, "</y><z>");
+  p = writeValue(p, a.z());
+  p = writeTag(p, "</z></Cartesian>");
+  *p = 0;
+  return p - a_buffer;
+}
+
+unsigned long Coords::toXML(const spherical& a, char* a_buffer) {
+  char* p(a_buffer);
+  p = writeTag(p, "<spherical><r>");
+  p = writeValue(p, a.r());
+  p = writeTag(p, "</r><theta>");
+  p = writeValue(p, a.theta().degrees());
+  p = writeTag(p, "</theta><phi>");
+  p = writeValue(p, a.phi().degrees());
+  p = writeTag(p, "</phi></spherical>");
+  *p = 0;
+  return p - a_buffer;
+}
+
+
+// ---------------------------------
+// ----- class xmlRecordWriter -----
+// ---------------------------------
+
+const unsigned long Coords::xmlRecordWriter::buffer_size(1 << 20);
+
+Coords::xmlRecordWriter::xmlRecordWriter(const std::string& flnm)
+  : m_flnm(flnm), m_file(fopen(flnm.c_str(), "wb")), m_buffer(buffer_size), m_used(0) {
+  if (!m_file) {
+    std::stringstream err;
+    err << "Error: unable to open file \"" << flnm << "\"";
+    throw xmlRecordError(err.str());
+  }
+}
+
+Coords::xmlRecordWriter::~xmlRecordWriter() {
+  if (m_file) {
+    if (m_used != 0)
+      fwrite(m_buffer.data(), 1, m_used, m_file);
+    fclose(m_file);
+  }
+}
+
+void Coords::xmlRecordWriter::write(const Cartesian& a) {
+  char* p(reserve());
+  const unsigned long n(toXML(a, p));
+  p[n] = '\n';
+  m_used += n + 1;
+}
+
+void Coords::xmlRecordWriter::write(const spherical& a) {
+  char* p(reserve());
+  const unsigned long n(toXML(a, p));
+  p[n] = '\n';
+  m_used += n + 1;
+}
+
+void Coords::xmlRecordWriter::close() {
+  if (!m_file)
+    return;
+  flush();
+  FILE* file(m_file);
+  m_file = 0;
+  if (fclose(file) != 0)
+    error();
+}
+
+char* Coords::xmlRecordWriter::reserve() {
+  if (!m_file)
+    error();
+  if (buffer_size - m_used < xml_record_size)
+    flush();
+  return m_buffer.data() + m_used;
+}
+
+void Coords::xmlRecordWriter::flush() {
+  if (m_used != 0 && fwrite(m_buffer.data(), 1, m_used, m_file) != m_used)
+    error();
+  m_used = 0;
+}
+
+void Coords::xmlRecordWriter::error() {
+  std::stringstream err;
+  err << "Error: unable to write file \"" << m_flnm << "\"";
+  throw xmlRecordError(err.str());
+}
+
+
+// ---------------------------------
+// ----- class xmlRecordParser -----
+// ---------------------------------
+
+Coords::xmlRecordParser::xmlRecordParser(const char* a_begin, const char* a_end)
+  : m_map(0), m_map_size(0), m_begin(a_begin), m_end(a_end), m_next(a_begin) {}
+
+Coords::xmlRecordParser::xmlRecordParser(const std::string& flnm)
+  : m_map(0), m_map_size(0), m_begin(0), m_end(0), m_next(0) {
+
+  int fd(open(flnm.c_str(), O_RDONLY));
+  if (fd < 0)
+    throw xmlRecordError("Error: unable to read file \"" + flnm + "\": can not open");
+
+  struct stat status;
+  if (fstat(fd, &status) != 0) {
+    ::close(fd);
+    throw xmlRecordError("Error: unable to read file \"" + flnm + "\": can not stat");
+  }
+
+  m_map_size = status.st_size;
+
+  if (m_map_size != 0) {
+
+    m_map = mmap(0, m_map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    if (m_map == MAP_FAILED) {
+      m_map = 0;
+      ::close(fd);
+      throw xmlRecordError("Error: unable to read file \"" + flnm + "\": can not map");
+    }
+
+    madvise(m_map, m_map_size, MADV_SEQUENTIAL); // read ahead, drop behind
+  }
+
+  ::close(fd); // the mapping keeps the file
+
+  m_begin = m_next = static_cast<const char*>(m_map);
+  m_end = m_begin + m_map_size;
+}
+
+Coords::xmlRecordParser::~xmlRecordParser() {
+  if (m_map)
+    munmap(m_map, m_map_size);
+}
+
+Coords::xmlRecordParser::record Coords::xmlRecordParser::next() {
+
+  while (m_next < m_end && isSpace(*m_next))
+    ++m_next;
+
+  if (m_next == m_end)
+    return end_of_records;
+
+  static const char s_Cartesian[] = "<Cartesian>";
+  static const char s_spherical[] = "<spherical>";
+
+  const unsigned long remaining(m_end - m_next);
+
+  if (remaining >= sizeof(s_Cartesian) - 1 && memcmp(m_next, s_Cartesian, sizeof(s_Cartesian) - 1) == 0) {
+
+    m_next += sizeof(s_Cartesian) - 1;
+
+    const double x(field("<x>", "</x>"));
+    const double y(field("<y>", "</y>"));
+    const double z(field("<z>", "</z>"));
+    expect("</Cartesian>");
+
+    m_Cartesian = Cartesian(x, y, z);
+    return Cartesian_record;
+  }
+
+  if (remaining >= sizeof(s_spherical) - 1 && memcmp(m_next, s_spherical, sizeof(s_spherical) - 1) == 0) {
+
+    m_next += sizeof(s_spherical) - 1;
+
+    const double r(field("<r>", "</r>"));
+    const double theta(field("<theta>", "</theta>"));
+    const double phi(field("<phi>", "</phi>"));
+    expect("</spherical>");
+
+    // as the string constructor, through angle(double)
+    m_spherical = spherical(r, angle(theta), angle(phi));
+    return spherical_record;
+  }
+
+  error("not a Cartesian or spherical record");
+  return end_of_records;
+}
+
+// <tag> value </tag>
+double Coords::xmlRecordParser::field(const char* a_open, const char* a_close) {
+
+  expect(a_open);
+
+  const char* close(static_cast<const char*>(memchr(m_next, '<', m_end - m_next)));
+  if (!close)
+    error(std::string("no ") + a_close);
+
+  double value;
+  if (!parseDouble(m_next, close, value))
+    error(std::string("not a number in ") + a_open);
+
+  m_next = close;
+  expect(a_close);
+
+  return value;
+}
+
+void Coords::xmlRecordParser::expect(const char* a_tag) {
+
+  while (m_next < m_end && isSpace(*m_next))
+    ++m_next;
+
+  const unsigned long n(strlen(a_tag));
+
+  if (static_cast<unsigned long>(m_end - m_next) < n || memcmp(m_next, a_tag, n) != 0)
+    error(std::string("expected ") + a_tag);
+
+  m_next += n;
+}
+
+void Coords::xmlRecordParser::error(const std::string& why) {
+  std::stringstream err;
+  err << "Error: malformed xml record at offset " << offset() << ": " << why;
+  throw xmlRecordError(err.str());
+}
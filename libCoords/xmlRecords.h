@@ -0,0 +1,158 @@
+// ================================================================
+// Filename:    xmlRecords.h
+//
+// Description: This defines a writer and a pull parser for files of
+//              Cartesian and spherical records in the XML operator<<
+//              format, e.g. state snapshots, one record per line:
+//
+//                <Cartesian><x>1</x><y>2</y><z>3</z></Cartesian>
+//                <spherical><r>1</r><theta>90</theta><phi>45</phi></spherical>
+//
+//              The writer formats each record in place in a large
+//              buffer and writes it in big blocks. The text is the
+//              same as operator<<, so values are %g, six digits.
+//
+//              The parser reads a memory mapped file, or any buffer,
+//              in place one record at a time and keeps only the last
+//              record, so files of any size are read in constant
+//              memory without copying. A record is the same as the
+//              string constructor given the element text. White space
+//              between tags and around values is ignored.
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coords is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coords is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coords.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <angle.h>
+#include <Cartesian.h>
+#include <spherical.h>
+#include <utils.h>
+
+namespace Coords {
+
+  class xmlRecordError : public Error {
+  public:
+  xmlRecordError(const std::string& msg) : Error(msg) {}
+  };
+
+  // ---------------------------------
+  // ----- formatting to buffers -----
+  // ---------------------------------
+
+  // The operator<< text of a, with a NUL, in a_buffer of at least
+  // xml_record_size chars. Returns the length, not counting the NUL.
+  const unsigned long xml_record_size(128);
+
+  unsigned long toXML(const Cartesian& a, char* a_buffer);
+  unsigned long toXML(const spherical& a, char* a_buffer);
+
+  // ---------------------------------
+  // ----- class xmlRecordWriter -----
+  // ---------------------------------
+
+  // Throws xmlRecordError if flnm can not be opened or written.
+
+  class xmlRecordWriter {
+
+  public:
+
+    static const unsigned long buffer_size;
+
+    explicit xmlRecordWriter(const std::string& flnm);
+    ~xmlRecordWriter(); // closes, ignoring errors
+
+    xmlRecordWriter(const xmlRecordWriter&) = delete;
+    xmlRecordWriter& operator=(const xmlRecordWriter&) = delete;
+
+    // one record and a new line
+    void write(const Cartesian& a);
+    void write(const spherical& a);
+
+    void close();
+
+  private:
+
+    char* reserve(); // room for xml_record_size chars
+    void  flush();
+    void  error();
+
+    std::string       m_flnm;
+    FILE*             m_file;
+    std::vector<char> m_buffer;
+    unsigned long     m_used;
+
+  };
+
+  // ---------------------------------
+  // ----- class xmlRecordParser -----
+  // ---------------------------------
+
+  // next() throws xmlRecordError, with the offset, at text that is
+  // not a record. The file constructor throws xmlRecordError if the
+  // file can not be mapped.
+
+  class xmlRecordParser {
+
+  public:
+
+    enum record {end_of_records, Cartesian_record, spherical_record};
+
+    // parses [a_begin, a_end), which must outlive the parser
+    xmlRecordParser(const char* a_begin, const char* a_end);
+
+    // maps flnm read only
+    explicit xmlRecordParser(const std::string& flnm);
+
+    ~xmlRecordParser();
+
+    xmlRecordParser(const xmlRecordParser&) = delete;
+    xmlRecordParser& operator=(const xmlRecordParser&) = delete;
+
+    // Reads the next record, end_of_records after the last.
+    record next();
+
+    // the last record read of each type
+    const Cartesian& getCartesian() const {return m_Cartesian;}
+    const spherical& getSpherical() const {return m_spherical;}
+
+    unsigned long offset() const {return m_next - m_begin;} // chars read
+
+  private:
+
+    double field(const char* a_open, const char* a_close);
+    void   expect(const char* a_tag);
+    void   error(const std::string& why);
+
+    void*         m_map;
+    unsigned long m_map_size;
+
+    const char* m_begin;
+    const char* m_end;
+    const char* m_next;
+
+    Cartesian m_Cartesian;
+    spherical m_spherical;
+
+  };
+
+} // end namespace Coords
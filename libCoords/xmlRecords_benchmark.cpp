@@ -0,0 +1,115 @@
+// ================================================================
+// Filename:    xmlRecords_benchmark.cpp
+// Description: Benchmarks of writing and parsing the XML operator<<
+//              format, against operator<< and the string
+//              constructors.
+//
+//              Buffer benchmarks are per call over s_size records.
+//
+// Author:      L.R. McFarland, lrm@starbug.com
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coordinates is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#include <sstream>
+#include <string>
+
+#include <angle.h>
+#include <benchmark.h>
+#include <Cartesian.h>
+#include <spherical.h>
+#include <xmlRecords.h>
+
+namespace {
+
+  using Coords::benchmark::doNotOptimize;
+
+  // ----------------
+  // ----- data -----
+  // ----------------
+
+  const unsigned long s_size(4096);
+
+  std::string records() {
+    std::stringstream text;
+    for (unsigned long i = 0; i < s_size; ++i)
+      text << Coords::Cartesian(i * 0.37 - 700, 1.0/(i + 1), i * 1e5) << '\n';
+    return text.str();
+  }
+
+  const std::string s_records(records());
+
+  // -------------------
+  // ----- writing -----
+  // -------------------
+
+  COORDS_BENCHMARK(Cartesian_operator_output) {
+    const Coords::Cartesian a(-123.456, 0.001234567, 7.5e10);
+    for (unsigned long i = 0; i < count; ++i) {
+      std::stringstream out;
+      out << a;
+      doNotOptimize(out);
+    }
+  }
+
+  COORDS_BENCHMARK(Cartesian_toXML) {
+    Coords::Cartesian a(-123.456, 0.001234567, 7.5e10);
+    char buffer[Coords::xml_record_size];
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(a);
+      doNotOptimize(Coords::toXML(a, buffer));
+    }
+  }
+
+  COORDS_BENCHMARK(spherical_toXML) {
+    Coords::spherical a(1.5, Coords::angle(45.25), Coords::angle(-123.456));
+    char buffer[Coords::xml_record_size];
+    for (unsigned long i = 0; i < count; ++i) {
+      doNotOptimize(a);
+      doNotOptimize(Coords::toXML(a, buffer));
+    }
+  }
+
+  // -------------------
+  // ----- parsing -----
+  // -------------------
+
+  // what a reader without a parser does, find each element and call
+  // the string constructor
+  COORDS_BENCHMARK(Cartesian_find_string_ctor_4096) {
+    for (unsigned long i = 0; i < count; ++i) {
+      std::string::size_type p(0);
+      while ((p = s_records.find("<x>", p)) != std::string::npos) {
+	const std::string::size_type x(p + 3);
+	const std::string::size_type y(s_records.find("<y>", x) + 3);
+	const std::string::size_type z(s_records.find("<z>", y) + 3);
+	doNotOptimize(Coords::Cartesian(s_records.substr(x, s_records.find('<', x) - x),
+					s_records.substr(y, s_records.find('<', y) - y),
+					s_records.substr(z, s_records.find('<', z) - z)));
+	p = z;
+      }
+    }
+  }
+
+  COORDS_BENCHMARK(xmlRecordParser_4096) {
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::xmlRecordParser parser(s_records.data(), s_records.data() + s_records.size());
+      while (parser.next() != Coords::xmlRecordParser::end_of_records)
+	doNotOptimize(parser.getCartesian());
+    }
+  }
+
+} // end anonymous namespace
@@ -0,0 +1,314 @@
+// ================================================================
+// Filename:    xmlRecords_unittest.cpp
+// Description: This is the gtest unittest of the XML record writer
+//              and pull parser. Written records are checked against
+//              operator<< and parsed records against the string
+//              constructors.
+//
+// Author:      L.R. McFarland, lrm@starbug.com
+// Created:     2026 Oct 16
+// Language:    C++
+//
+// See also: http://code.google.com/p/googletest/wiki/Primer
+//
+//  Coordinates is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <angle.h>
+#include <Cartesian.h>
+#include <spherical.h>
+#include <utils.h>
+#include <xmlRecords.h>
+
+
+namespace {
+
+  std::string streamed(const Coords::Cartesian& a) {
+    std::stringstream out;
+    out << a;
+    return out.str();
+  }
+
+  std::string streamed(const Coords::spherical& a) {
+    std::stringstream out;
+    out << a;
+    return out.str();
+  }
+
+  std::string temporaryFile() {
+    char flnm[] = "/tmp/xmlRecords_unittest_XXXXXX";
+    const int fd(mkstemp(flnm));
+    if (fd >= 0)
+      close(fd);
+    return flnm;
+  }
+
+  // -----------------------
+  // ----- Fixed utils -----
+  // -----------------------
+
+  TEST(FixedXMLRecords, ParseDouble) {
+    const char* numbers[] = {"0", "-0", "1", "-1.5", "1e+06", "1.23457e-05", "  42  ",
+			     "0.1", "123456789012345678901234", "1e-320", "inf", "-nan",
+			     "0x1p3", "1.7976931348623157e308", "4.9e-324", ".5", "5."};
+
+    for (unsigned long i = 0; i < sizeof(numbers)/sizeof(numbers[0]); ++i) {
+      const std::string s(numbers[i]);
+      double value(0);
+      EXPECT_TRUE(Coords::parseDouble(s.data(), s.data() + s.size(), value)) << s;
+      const double expected(Coords::stod(s));
+      if (expected == expected)
+	EXPECT_EQ(expected, value) << s;
+      else
+	EXPECT_NE(value, value) << s;
+    }
+  }
+
+  TEST(FixedXMLRecords, ParseDoubleBad) {
+    const char* bad[] = {"", " ", "-", "1 2", "1e", "1x", ".", "e5", "--1"};
+
+    for (unsigned long i = 0; i < sizeof(bad)/sizeof(bad[0]); ++i) {
+      const std::string s(bad[i]);
+      double value(42);
+      EXPECT_FALSE(Coords::parseDouble(s.data(), s.data() + s.size(), value)) << "'" << s << "'";
+      EXPECT_EQ(42, value);
+    }
+  }
+
+  TEST(FixedXMLRecords, ParseDoubleRangeIsNotTerminated) {
+    const char buffer[] = "12.57";
+    double value;
+    EXPECT_TRUE(Coords::parseDouble(buffer, buffer + 4, value));
+    EXPECT_EQ(12.5, value);
+  }
+
+  TEST(FixedXMLRecords, ParseDecimal) {
+    // the number and what follows it
+    const char* numbers[][2] = {{"12.5", ""}, {"12.5:30", ":30"}, {"1e3x", "x"}, {"1e", "e"},
+				{"1e+", "e+"}, {"2.5E-3 ", " "}, {"12345678901234567890123.5d", "d"},
+				{"1e99999999", ""}, {"0.000000000000000000000000001s", "s"}};
+
+    for (unsigned long i = 0; i < sizeof(numbers)/sizeof(numbers[0]); ++i) {
+      const std::string s(numbers[i][0]);
+      const char* p(s.data());
+      double value(0);
+      EXPECT_TRUE(Coords::parseDecimal(p, s.data() + s.size(), value)) << s;
+      EXPECT_EQ(std::string(numbers[i][1]), std::string(p, s.data() + s.size())) << s;
+      EXPECT_EQ(Coords::stod(s.substr(0, s.size() - strlen(numbers[i][1]))), value) << s;
+    }
+
+    const std::string a("3e2");
+    const char* p(a.data());
+    double value(0);
+    EXPECT_TRUE(Coords::parseDecimal(p, a.data() + a.size(), value, false));
+    EXPECT_EQ(3, value);
+    EXPECT_EQ('e', *p);
+
+    const char* bad[] = {"", ".", "-1", "+1", "e5", " 1"};
+    for (unsigned long i = 0; i < sizeof(bad)/sizeof(bad[0]); ++i) {
+      const std::string s(bad[i]);
+      const char* q(s.data());
+      value = 42;
+      EXPECT_FALSE(Coords::parseDecimal(q, s.data() + s.size(), value)) << "'" << s << "'";
+      EXPECT_EQ(s.data(), q);
+      EXPECT_EQ(42, value);
+    }
+
+    const std::string negative_zero("-0.0");
+    EXPECT_TRUE(Coords::parseDouble(negative_zero.data(), negative_zero.data() + negative_zero.size(), value));
+    EXPECT_TRUE(std::signbit(value));
+  }
+
+  TEST(FixedXMLRecords, Double2String) {
+    const double values[] = {0, -0.0, 1, -1.5, 1e6, 123456.5, 1.23456789e-5, 1e-300,
+			     std::numeric_limits<double>::infinity(),
+			     std::numeric_limits<double>::quiet_NaN()};
+
+    for (unsigned long i = 0; i < sizeof(values)/sizeof(values[0]); ++i) {
+      std::stringstream out;
+      out << values[i];
+      char buffer[Coords::double_string_size];
+      EXPECT_EQ(out.str().size(), Coords::double2String(values[i], buffer));
+      EXPECT_STREQ(out.str().c_str(), buffer);
+    }
+  }
+
+  // ----------------------------
+  // ----- Fixed xmlRecords -----
+  // ----------------------------
+
+  TEST(FixedXMLRecords, ToXML) {
+    const Coords::Cartesian a(1, -2.5, 3e-7);
+    const Coords::spherical b(1, Coords::angle(45), Coords::angle(-123.456789));
+    char buffer[Coords::xml_record_size];
+
+    EXPECT_EQ(streamed(a).size(), Coords::toXML(a, buffer));
+    EXPECT_STREQ(streamed(a).c_str(), buffer);
+
+    EXPECT_EQ(streamed(b).size(), Coords::toXML(b, buffer));
+    EXPECT_STREQ(streamed(b).c_str(), buffer);
+  }
+
+  TEST(FixedXMLRecords, Parse) {
+    const std::string text("<Cartesian><x>1</x><y>-2.5</y><z>3e-07</z></Cartesian>\n"
+			   "  <spherical> <r> 1 </r>\n"
+			   "    <theta>45</theta> <phi>-123.457</phi>\n"
+			   "  </spherical>\n\n");
+
+    Coords::xmlRecordParser parser(text.data(), text.data() + text.size());
+
+    EXPECT_EQ(Coords::xmlRecordParser::Cartesian_record, parser.next());
+    EXPECT_EQ(Coords::Cartesian("1", "-2.5", "3e-07"), parser.getCartesian());
+
+    EXPECT_EQ(Coords::xmlRecordParser::spherical_record, parser.next());
+    EXPECT_EQ(Coords::spherical("1", "45", "-123.457"), parser.getSpherical());
+
+    EXPECT_EQ(Coords::xmlRecordParser::end_of_records, parser.next());
+    EXPECT_EQ(Coords::xmlRecordParser::end_of_records, parser.next());
+    EXPECT_EQ(text.size(), parser.offset());
+  }
+
+  TEST(FixedXMLRecords, Empty) {
+    Coords::xmlRecordParser parser(0, 0);
+    EXPECT_EQ(Coords::xmlRecordParser::end_of_records, parser.next());
+  }
+
+  TEST(FixedXMLRecords, Malformed) {
+    const char* bad[] = {"<Cartesian><x>1</x><y>2</y></Cartesian>",
+			 "<Cartesian><x>1</x><y>2</y><z>3</z>",
+			 "<Cartesian><x>one</x><y>2</y><z>3</z></Cartesian>",
+			 "<Cartesian><x>1</x><y>2</y><z>3",
+			 "<spherical><r>1</r><phi>2</phi><theta>3</theta></spherical>",
+			 "<angle>12</angle>"};
+
+    for (unsigned long i = 0; i < sizeof(bad)/sizeof(bad[0]); ++i) {
+      Coords::xmlRecordParser parser(bad[i], bad[i] + strlen(bad[i]));
+      EXPECT_THROW(parser.next(), Coords::xmlRecordError) << bad[i];
+    }
+  }
+
+  TEST(FixedXMLRecords, MalformedOffset) {
+    const std::string text("<Cartesian><x>1</x><y>2</y><z>3</z></Cartesian>\n<Cartesian><x>");
+    Coords::xmlRecordParser parser(text.data(), text.data() + text.size());
+
+    EXPECT_EQ(Coords::xmlRecordParser::Cartesian_record, parser.next());
+
+    try {
+      parser.next();
+      FAIL() << "no exception";
+    } catch (Coords::xmlRecordError& err) {
+      EXPECT_STREQ("Error: malformed xml record at offset 62: no </x>", err.what());
+    }
+  }
+
+  TEST(FixedXMLRecords, NoFile) {
+    EXPECT_THROW(Coords::xmlRecordParser parser("/no/such/file.xml"), Coords::xmlRecordError);
+    EXPECT_THROW(Coords::xmlRecordWriter writer("/no/such/file.xml"), Coords::xmlRecordError);
+  }
+
+  // -----------------------------
+  // ----- Random xmlRecords -----
+  // -----------------------------
+
+  class RandomXMLRecords : public ::testing::Test {
+    // Creates new random values each test.
+  protected:
+
+    virtual void SetUp() {
+      seed = std::chrono::system_clock::now().time_since_epoch().count();
+      generator.seed(seed);
+    }
+
+    virtual void TearDown() {}
+
+    double random() {
+      return ldexp(mantissa(generator), exponent(generator));
+    }
+
+    // members
+
+    unsigned int seed;
+    std::default_random_engine generator;
+    std::uniform_real_distribution<double> mantissa{-1, 1};
+    std::uniform_int_distribution<int> exponent{-40, 40};
+
+  };
+
+  TEST_F(RandomXMLRecords, FileRoundTrip) {
+    const std::string flnm(temporaryFile());
+    const unsigned long size(100000);
+
+    std::vector<Coords::Cartesian> cartesians;
+    std::vector<Coords::spherical> sphericals;
+
+    Coords::xmlRecordWriter writer(flnm);
+    for (unsigned long i = 0; i < size; ++i) {
+      cartesians.push_back(Coords::Cartesian(random(), random(), random()));
+      sphericals.push_back(Coords::spherical(random(), Coords::angle(random()), Coords::angle(random())));
+      writer.write(cartesians.back());
+      writer.write(sphericals.back());
+    }
+    writer.close();
+
+    Coords::xmlRecordParser parser(flnm);
+
+    for (unsigned long i = 0; i < size; ++i) {
+
+      ASSERT_EQ(Coords::xmlRecordParser::Cartesian_record, parser.next()) << "seed " << seed;
+
+      // the expected record is the string constructor of the streamed text
+      std::stringstream x, y, z;
+      x << cartesians[i].x();
+      y << cartesians[i].y();
+      z << cartesians[i].z();
+      EXPECT_EQ(Coords::Cartesian(x.str(), y.str(), z.str()), parser.getCartesian()) << "seed " << seed;
+
+      ASSERT_EQ(Coords::xmlRecordParser::spherical_record, parser.next()) << "seed " << seed;
+
+      std::stringstream r, theta, phi;
+      r << sphericals[i].r();
+      theta << sphericals[i].theta().degrees();
+      phi << sphericals[i].phi().degrees();
+      EXPECT_EQ(Coords::spherical(r.str(), theta.str(), phi.str()), parser.getSpherical()) << "seed " << seed;
+    }
+
+    EXPECT_EQ(Coords::xmlRecordParser::end_of_records, parser.next());
+
+    unlink(flnm.c_str());
+  }
+
+} // end anonymous namespace
+
+
+// ==================
+// ===== main() =====
+// ==================
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,278 @@
+// ================================================================
+// Filename:    zoneIndex.cpp
+//
+// Description: Implements the declination zone index.
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coords is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coords is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coords.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#include <algorithm>
+#include <cmath>
+
+#include <angle.h>
+#include <Cartesian.h>
+#include <CartesianArray.h>
+#include <spherical.h>
+#include <zoneIndex.h>
+
+namespace {
+
+  // Widens the zone and right ascension bounds so rounding in the
+  // bounds never drops a position the exact dot product test keeps.
+  const double s_pad(1e-9); // degrees
+
+  typedef std::pair<double, unsigned long> candidate; // (dot, id)
+
+  // nearest first, then by index
+  bool nearer(const candidate& lhs, const candidate& rhs) {
+    return lhs.first > rhs.first || (lhs.first == rhs.first && lhs.second < rhs.second);
+  }
+
+  // right ascension in [0, 360) and declination of a unit vector
+  void raDec(const double& x, const double& y, const double& z, double& ra, double& dec) {
+    dec = Coords::angle::rad2deg(asin(std::max(-1.0, std::min(1.0, z))));
+    ra = Coords::angle::rad2deg(atan2(y, x));
+    if (ra < 0)
+      ra += 360;
+    if (ra >= 360) // -tiny + 360 rounds to 360
+      ra = 0;
+  }
+
+} // end anonymous namespace
+
+
+// ---------------------------
+// ----- class zoneIndex -----
+// ---------------------------
+
+const double Coords::zoneIndex::default_zone_height(0.1);
+
+// ----- ctor and dtor -----
+
+Coords::zoneIndex::zoneIndex(const Coords::CartesianArray& positions, const double& zone_height)
+  : m_zone_height(zone_height) {
+  build(positions, zone_height);
+}
+
+Coords::zoneIndex::zoneIndex(const std::vector<Coords::spherical>& positions, const double& zone_height)
+  : m_zone_height(zone_height) {
+  Coords::CartesianArray directions(positions.size());
+  for (unsigned long i = 0; i < positions.size(); ++i)
+    directions.set(i, Coords::Cartesian(positions[i]));
+  build(directions, zone_height);
+}
+
+void Coords::zoneIndex::build(const Coords::CartesianArray& positions, const double& zone_height) {
+
+  if (!(zone_height > 0 && zone_height <= 180))
+    throw Coords::Error("zone height must be more than 0 and at most 180 degrees");
+
+  const unsigned long n(positions.size());
+  const unsigned long n_zones(static_cast<unsigned long>(ceil(180/zone_height)));
+
+  // unit vectors, right ascension and zone of each position
+
+  std::vector<double> x(n), y(n), z(n), ra(n);
+  std::vector<unsigned long> zone(n);
+
+  for (unsigned long i = 0; i < n; ++i) {
+
+    const double h(sqrt(positions.x()[i]*positions.x()[i] +
+			positions.y()[i]*positions.y()[i] +
+			positions.z()[i]*positions.z()[i]));
+
+    if (h == 0)
+      throw Coords::Error("zoneIndex position has no direction");
+
+    x[i] = positions.x()[i]/h;
+    y[i] = positions.y()[i]/h;
+    z[i] = positions.z()[i]/h;
+
+    double dec;
+    raDec(x[i], y[i], z[i], ra[i], dec);
+
+    zone[i] = std::min(n_zones - 1, static_cast<unsigned long>((dec + 90)/zone_height));
+  }
+
+  // counting sort into zones, then each zone by right ascension
+
+  m_zone.assign(n_zones + 1, 0);
+  for (unsigned long i = 0; i < n; ++i)
+    ++m_zone[zone[i] + 1];
+  for (unsigned long i = 0; i < n_zones; ++i)
+    m_zone[i + 1] += m_zone[i];
+
+  std::vector<unsigned long> next(m_zone.begin(), m_zone.end() - 1);
+  std::vector< std::pair<double, unsigned long> > order(n); // (ra, id)
+  for (unsigned long i = 0; i < n; ++i)
+    order[next[zone[i]]++] = std::make_pair(ra[i], i);
+
+  for (unsigned long i = 0; i < n_zones; ++i)
+    std::sort(order.begin() + m_zone[i], order.begin() + m_zone[i + 1]);
+
+  m_ra.resize(n);
+  m_x.resize(n);
+  m_y.resize(n);
+  m_z.resize(n);
+  m_id.resize(n);
+
+  for (unsigned long i = 0; i < n; ++i) {
+    const unsigned long id(order[i].second);
+    m_ra[i] = order[i].first;
+    m_x[i] = x[id];
+    m_y[i] = y[id];
+    m_z[i] = z[id];
+    m_id[i] = id;
+  }
+}
+
+// ----- queries -----
+
+void Coords::zoneIndex::search(const Coords::Cartesian& center, const double& radius_deg,
+			       const double& min_dot, std::vector<candidate>& result) const {
+
+  result.clear();
+
+  double ra, dec;
+  raDec(center.x(), center.y(), center.z(), ra, dec);
+
+  const double dec_lo(dec - radius_deg - s_pad);
+  const double dec_hi(dec + radius_deg + s_pad);
+
+  // widest right ascension half width of the cone, or all of each
+  // zone if the cone holds a pole
+  double half_width(180);
+  if (dec_lo > -90 && dec_hi < 90) {
+    const double s(sin(Coords::angle::deg2rad(radius_deg))/cos(Coords::angle::deg2rad(dec)));
+    half_width = Coords::angle::rad2deg(asin(std::min(1.0, s))) + s_pad;
+  }
+
+  // right ascension ranges, split at 0/360
+  double lo[2] = {0, 0}, hi[2] = {360, 360};
+  unsigned int ranges(1);
+  if (half_width < 180) {
+    lo[0] = ra - half_width;
+    hi[0] = ra + half_width;
+    if (lo[0] < 0) {
+      lo[1] = lo[0] + 360;
+      lo[0] = 0;
+      ranges = 2;
+    } else if (hi[0] >= 360) {
+      hi[1] = hi[0] - 360;
+      hi[0] = 360;
+      ranges = 2;
+    }
+  }
+
+  const unsigned long last_zone(zones() - 1);
+  const unsigned long z_lo(dec_lo <= -90 ? 0 :
+			   std::min(last_zone, static_cast<unsigned long>((dec_lo + 90)/m_zone_height)));
+  const unsigned long z_hi(dec_hi >= 90 ? last_zone :
+			   std::min(last_zone, static_cast<unsigned long>((dec_hi + 90)/m_zone_height)));
+
+  const double cx(center.x()), cy(center.y()), cz(center.z());
+
+  for (unsigned long zone = z_lo; zone <= z_hi; ++zone) {
+
+    const double* first(m_ra.data() + m_zone[zone]);
+    const double* last(m_ra.data() + m_zone[zone + 1]);
+
+    for (unsigned int r = 0; r < ranges; ++r) {
+
+      const unsigned long begin(std::lower_bound(first, last, lo[r]) - m_ra.data());
+      const unsigned long end(std::upper_bound(first, last, hi[r]) - m_ra.data());
+
+      for (unsigned long i = begin; i < end; ++i) {
+	const double dot(m_x[i]*cx + m_y[i]*cy + m_z[i]*cz);
+	if (dot >= min_dot)
+	  result.push_back(candidate(dot, m_id[i]));
+      }
+    }
+  }
+}
+
+void Coords::zoneIndex::coneSearch(const Coords::Cartesian& center, const Coords::angle& radius,
+				   std::vector<unsigned long>& result) const {
+
+  result.clear();
+
+  if (center.magnitude() == 0)
+    throw Coords::Error("zoneIndex search center has no direction");
+
+  if (radius.degrees() < 0 || size() == 0)
+    return;
+
+  const double min_dot(radius.degrees() >= 180 ? -2 : cos(radius.radians()));
+
+  std::vector<candidate> candidates;
+  search(center.normalized(), std::min(180.0, radius.degrees()), min_dot, candidates);
+
+  result.resize(candidates.size());
+  for (unsigned long i = 0; i < candidates.size(); ++i)
+    result[i] = candidates[i].second;
+}
+
+void Coords::zoneIndex::coneSearch(const Coords::spherical& center, const Coords::angle& radius,
+				   std::vector<unsigned long>& result) const {
+  coneSearch(Coords::Cartesian(center), radius, result);
+}
+
+void Coords::zoneIndex::nearest(const Coords::Cartesian& center, const unsigned long& k,
+				std::vector<unsigned long>& result) const {
+
+  result.clear();
+
+  if (center.magnitude() == 0)
+    throw Coords::Error("zoneIndex search center has no direction");
+
+  if (k == 0 || size() == 0)
+    return;
+
+  const Coords::Cartesian direction(center.normalized());
+
+  // Any cone holding at least k positions holds the k nearest. Start
+  // with the cone that would hold 2k for uniform positions and double
+  // the radius until it is enough.
+  double radius(2*Coords::angle::rad2deg(acos(std::max(-1.0, 1.0 - 2.0*k/size()))));
+  radius = std::max(radius, m_zone_height);
+
+  std::vector<candidate> candidates;
+
+  for (;;) {
+    if (radius >= 180) {
+      search(direction, 180, -2, candidates);
+      break;
+    }
+    search(direction, radius, cos(Coords::angle::deg2rad(radius)), candidates);
+    if (candidates.size() >= k)
+      break;
+    radius *= 2;
+  }
+
+  const unsigned long n(std::min(k, static_cast<unsigned long>(candidates.size())));
+  std::partial_sort(candidates.begin(), candidates.begin() + n, candidates.end(), nearer);
+
+  result.resize(n);
+  for (unsigned long i = 0; i < n; ++i)
+    result[i] = candidates[i].second;
+}
+
+void Coords::zoneIndex::nearest(const Coords::spherical& center, const unsigned long& k,
+				std::vector<unsigned long>& result) const {
+  nearest(Coords::Cartesian(center), k, result);
+}
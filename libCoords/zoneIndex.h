@@ -0,0 +1,128 @@
+// ================================================================
+// Filename:    zoneIndex.h
+//
+// Description: This defines a declination zone index of directions
+//              for cone searches and nearest neighbors over large
+//              catalogs, e.g. all stars within a radius of a
+//              pointing.
+//
+//              The sphere is cut into zones of equal declination
+//              height and each zone is sorted by right ascension. A
+//              cone search visits only the zones the cone crosses
+//              and, in each, binary searches the right ascension
+//              range the cone can reach, so only a thin strip of
+//              candidates get the exact test, a dot product against
+//              cos(radius). There is no trig per candidate.
+//
+//              Declination and right ascension here are the latitude
+//              and longitude of the direction, i.e. 90 - theta and
+//              phi of a spherical.
+//
+//              The index does not change after it is built and
+//              queries keep no state in it, so any number of threads
+//              may query one index at the same time.
+//
+//              See also Gray, Szalay et al., "There Goes the
+//              Neighborhood: Relational Algebra for Spatial Data
+//              Search", MSR-TR-2004-32.
+//
+// Author:      L.R. McFarland
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coords is free software: you can redistribute it and/or modify it
+//  under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coords is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coords.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include <angle.h>
+#include <Cartesian.h>
+#include <CartesianArray.h>
+#include <spherical.h>
+
+namespace Coords {
+
+  // ---------------------------
+  // ----- class zoneIndex -----
+  // ---------------------------
+
+  class zoneIndex {
+  public:
+
+    static const double default_zone_height; // degrees
+
+    // ----- ctor and dtor -----
+
+    // Bulk builds from positions of any non-zero length, only the
+    // direction is kept. Results are indices into positions. Throws
+    // Coords::Error for a zero length position.
+
+    explicit zoneIndex(const CartesianArray& positions,
+		       const double& zone_height = default_zone_height);
+
+    explicit zoneIndex(const std::vector<spherical>& positions,
+		       const double& zone_height = default_zone_height);
+
+    ~zoneIndex() {};
+
+    // ----- accessors -----
+
+    unsigned long size() const        {return m_id.size();}
+    unsigned long zones() const       {return m_zone.size() - 1;}
+    const double& zoneHeight() const  {return m_zone_height;}
+
+    // ----- queries -----
+
+    // Indices of the positions within radius of center, in zone
+    // order. result is replaced. Throws Coords::Error for a zero
+    // length center, as does nearest().
+    void coneSearch(const Cartesian& center, const angle& radius,
+		    std::vector<unsigned long>& result) const;
+
+    void coneSearch(const spherical& center, const angle& radius,
+		    std::vector<unsigned long>& result) const;
+
+    // Indices of the k positions nearest center, nearest first, ties
+    // by index. All of them if k >= size(). result is replaced.
+    void nearest(const Cartesian& center, const unsigned long& k,
+		 std::vector<unsigned long>& result) const;
+
+    void nearest(const spherical& center, const unsigned long& k,
+		 std::vector<unsigned long>& result) const;
+
+  private:
+
+    void build(const CartesianArray& directions, const double& zone_height);
+
+    // candidates with dot(direction, center) >= min_dot, as (dot, id)
+    void search(const Cartesian& center, const double& radius_deg, const double& min_dot,
+		std::vector< std::pair<double, unsigned long> >& result) const;
+
+    // ----- data members -----
+
+    double m_zone_height; // degrees
+
+    std::vector<unsigned long> m_zone; // first entry of each zone, size zones() + 1
+
+    // entries in zone order, then by right ascension
+    std::vector<double>        m_ra;   // degrees in [0, 360)
+    std::vector<double>        m_x, m_y, m_z;
+    std::vector<unsigned long> m_id;   // index into the positions built from
+
+  };
+
+} // end namespace Coords
@@ -0,0 +1,129 @@
+// ================================================================
+// Filename:    zoneIndex_benchmark.cpp
+// Description: Benchmarks of cone searches and nearest neighbors
+//              with the declination zone index against a linear
+//              scan of the chord distances.
+//
+//              The catalog is s_size pseudo random directions, built
+//              on first use.
+//
+// Author:      L.R. McFarland, lrm@starbug.com
+// Created:     2026 Oct 16
+// Language:    C++
+//
+//  Coordinates is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <angle.h>
+#include <benchmark.h>
+#include <Cartesian.h>
+#include <CartesianArray.h>
+#include <distance.h>
+#include <zoneIndex.h>
+
+namespace {
+
+  using Coords::benchmark::doNotOptimize;
+
+  // ----------------
+  // ----- data -----
+  // ----------------
+
+  const unsigned long s_size(1 << 20);
+
+  const Coords::CartesianArray& catalog() {
+    static Coords::CartesianArray a;
+    if (a.size() == 0) {
+      std::default_random_engine generator(1);
+      std::normal_distribution<double> gaussian(0, 1);
+      for (unsigned long i = 0; i < s_size; ++i)
+	a.push_back(Coords::Cartesian(gaussian(generator), gaussian(generator), gaussian(generator)));
+    }
+    return a;
+  }
+
+  const Coords::zoneIndex& index() {
+    static const Coords::zoneIndex a(catalog());
+    return a;
+  }
+
+  const Coords::Cartesian s_center(Coords::Cartesian(1, 2, 3).normalized());
+
+  // -----------------------
+  // ----- cone search -----
+  // -----------------------
+
+  COORDS_BENCHMARK(zoneIndex_build_1M) {
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::zoneIndex a(catalog());
+      doNotOptimize(a.size());
+    }
+  }
+
+  // chord of 0.1 degrees between unit vectors, scanning every one
+  COORDS_BENCHMARK(linear_cone_search_1M_0_1_deg) {
+    const Coords::CartesianArray& directions(catalog());
+    Coords::CartesianArray units(directions.size());
+    for (unsigned long j = 0; j < directions.size(); ++j)
+      units.set(j, directions.get(j).normalized());
+
+    const double max_chord(2*sin(Coords::angle::deg2rad(0.1)/2));
+    std::vector<double> chords;
+    std::vector<unsigned long> result;
+    for (unsigned long i = 0; i < count; ++i) {
+      Coords::chordDistance(s_center, units, chords);
+      result.clear();
+      for (unsigned long j = 0; j < chords.size(); ++j)
+	if (chords[j] <= max_chord)
+	  result.push_back(j);
+      doNotOptimize(result.size());
+    }
+  }
+
+  COORDS_BENCHMARK(zoneIndex_cone_search_1M_0_1_deg) {
+    const Coords::zoneIndex& a(index());
+    std::vector<unsigned long> result;
+    for (unsigned long i = 0; i < count; ++i) {
+      a.coneSearch(s_center, Coords::angle(0.1), result);
+      doNotOptimize(result.size());
+    }
+  }
+
+  COORDS_BENCHMARK(zoneIndex_cone_search_1M_1_deg) {
+    const Coords::zoneIndex& a(index());
+    std::vector<unsigned long> result;
+    for (unsigned long i = 0; i < count; ++i) {
+      a.coneSearch(s_center, Coords::angle(1), result);
+      doNotOptimize(result.size());
+    }
+  }
+
+  // -----------------------------
+  // ----- nearest neighbors -----
+  // -----------------------------
+
+  COORDS_BENCHMARK(zoneIndex_nearest_1M_10) {
+    const Coords::zoneIndex& a(index());
+    std::vector<unsigned long> result;
+    for (unsigned long i = 0; i < count; ++i) {
+      a.nearest(s_center, 10, result);
+      doNotOptimize(result[0]);
+    }
+  }
+
+} // end anonymous namespace
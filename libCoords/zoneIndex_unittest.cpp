@@ -0,0 +1,247 @@
+// ================================================================
+// Filename:    zoneIndex_unittest.cpp
+// Description: This is the gtest unittest of the declination zone
+//              index. Cone searches and nearest neighbors are checked
+//              against a linear scan.
+//
+// Author:      L.R. McFarland, lrm@starbug.com
+// Created:     2026 Oct 16
+// Language:    C++
+//
+// See also: http://code.google.com/p/googletest/wiki/Primer
+//
+//  Coordinates is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  Coordinates is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Coordinates.  If not, see <http://www.gnu.org/licenses/>.
+// ================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <angle.h>
+#include <Cartesian.h>
+#include <CartesianArray.h>
+#include <spherical.h>
+#include <zoneIndex.h>
+
+
+namespace {
+
+  // ------------------------
+  // ----- linear scans -----
+  // ------------------------
+
+  std::vector<unsigned long> scanCone(const Coords::CartesianArray& positions,
+				      const Coords::Cartesian& center, const double& radius) {
+    std::vector<unsigned long> result;
+    const double min_dot(radius >= 180 ? -2 : cos(Coords::angle::deg2rad(radius)));
+    for (unsigned long i = 0; i < positions.size(); ++i)
+      if (positions.get(i).normalized() * center.normalized() >= min_dot)
+	result.push_back(i);
+    return result;
+  }
+
+  std::vector<unsigned long> scanNearest(const Coords::CartesianArray& positions,
+					 const Coords::Cartesian& center, const unsigned long& k) {
+    std::vector< std::pair<double, unsigned long> > by_distance;
+    for (unsigned long i = 0; i < positions.size(); ++i)
+      by_distance.push_back(std::make_pair(-(positions.get(i).normalized() * center.normalized()), i));
+    std::sort(by_distance.begin(), by_distance.end());
+
+    std::vector<unsigned long> result;
+    for (unsigned long i = 0; i < std::min(k, static_cast<unsigned long>(by_distance.size())); ++i)
+      result.push_back(by_distance[i].second);
+    return result;
+  }
+
+  std::vector<unsigned long> sorted(std::vector<unsigned long> a) {
+    std::sort(a.begin(), a.end());
+    return a;
+  }
+
+  // ---------------------------
+  // ----- Fixed zoneIndex -----
+  // ---------------------------
+
+  TEST(FixedZoneIndex, Empty) {
+    Coords::zoneIndex index((Coords::CartesianArray()));
+    EXPECT_EQ(0u, index.size());
+    EXPECT_EQ(1800u, index.zones());
+
+    std::vector<unsigned long> result(3);
+    index.coneSearch(Coords::Cartesian::Uz, Coords::angle(10), result);
+    EXPECT_TRUE(result.empty());
+    index.nearest(Coords::Cartesian::Uz, 5, result);
+    EXPECT_TRUE(result.empty());
+  }
+
+  TEST(FixedZoneIndex, Errors) {
+    Coords::CartesianArray a(1);
+    EXPECT_THROW(Coords::zoneIndex index(a), Coords::Error);
+
+    a.set(0, Coords::Cartesian::Ux);
+    EXPECT_THROW(Coords::zoneIndex index(a, 0), Coords::Error);
+
+    Coords::zoneIndex index(a, 1);
+    std::vector<unsigned long> result;
+    EXPECT_THROW(index.coneSearch(Coords::Cartesian(), Coords::angle(1), result), Coords::Error);
+    EXPECT_THROW(index.nearest(Coords::Cartesian(), 1, result), Coords::Error);
+  }
+
+  TEST(FixedZoneIndex, Spherical) {
+    std::vector<Coords::spherical> stars;
+    stars.push_back(Coords::spherical(10, Coords::Declination(89.99), Coords::angle(0)));
+    stars.push_back(Coords::spherical(20, Coords::Declination(89.99), Coords::angle(180)));
+    stars.push_back(Coords::spherical(30, Coords::Declination(0), Coords::angle(359.99)));
+    stars.push_back(Coords::spherical(40, Coords::Declination(0), Coords::angle(0.01)));
+    stars.push_back(Coords::spherical(50, Coords::Declination(-45), Coords::angle(90)));
+
+    Coords::zoneIndex index(stars);
+    EXPECT_EQ(5u, index.size());
+
+    std::vector<unsigned long> result;
+
+    // across the pole
+    index.coneSearch(Coords::spherical(1, Coords::Declination(90)), Coords::angle(0.02), result);
+    EXPECT_EQ(std::vector<unsigned long>({0, 1}), sorted(result));
+
+    // across right ascension 0
+    index.coneSearch(Coords::spherical(1, Coords::Declination(0), Coords::angle(0)),
+		     Coords::angle(0.02), result);
+    EXPECT_EQ(std::vector<unsigned long>({2, 3}), sorted(result));
+
+    index.nearest(Coords::spherical(1, Coords::Declination(-40), Coords::angle(80)), 2, result);
+    ASSERT_EQ(2u, result.size());
+    EXPECT_EQ(4u, result[0]);
+
+    index.coneSearch(Coords::Cartesian::Ux, Coords::angle(180), result);
+    EXPECT_EQ(5u, result.size());
+  }
+
+  // ----------------------------
+  // ----- Random zoneIndex -----
+  // ----------------------------
+
+  class RandomZoneIndex : public ::testing::Test {
+    // Creates a new random catalog and pointings each test.
+  protected:
+
+    virtual void SetUp() {
+
+      seed = std::chrono::system_clock::now().time_since_epoch().count();
+      size = 20000;
+      pointings = 100;
+
+      std::default_random_engine generator(seed);
+      std::normal_distribution<double> gaussian(0, 1);
+      std::uniform_real_distribution<double> radius(0, 1e3);
+
+      // uniform directions at random distances
+      for (unsigned long i = 0; i < size; ++i) {
+	Coords::Cartesian u(gaussian(generator), gaussian(generator), gaussian(generator));
+	catalog.push_back(u.normalized() * radius(generator));
+      }
+
+      for (unsigned long i = 0; i < pointings; ++i)
+	centers.push_back(Coords::Cartesian(gaussian(generator), gaussian(generator), gaussian(generator)));
+
+      // the poles and right ascension 0 too
+      centers.push_back(Coords::Cartesian::Uz);
+      centers.push_back(-Coords::Cartesian::Uz);
+      centers.push_back(Coords::Cartesian::Ux);
+    }
+
+    virtual void TearDown() {}
+
+    // members
+
+    unsigned int seed;
+    unsigned long size;
+    unsigned long pointings;
+
+    Coords::CartesianArray catalog;
+    std::vector<Coords::Cartesian> centers;
+
+  };
+
+  TEST_F(RandomZoneIndex, ConeSearch) {
+    Coords::zoneIndex index(catalog, 0.5);
+
+    const double radii[] = {0, 0.3, 2, 10, 75, 95, 179.9, 180};
+
+    std::vector<unsigned long> result;
+    for (unsigned long i = 0; i < centers.size(); ++i)
+      for (unsigned int r = 0; r < sizeof(radii)/sizeof(radii[0]); ++r) {
+	index.coneSearch(centers[i], Coords::angle(radii[r]), result);
+	EXPECT_EQ(scanCone(catalog, centers[i], Coords::angle(radii[r]).degrees()), sorted(result))
+	  << "seed " << seed << " center " << i << " radius " << radii[r];
+      }
+  }
+
+  TEST_F(RandomZoneIndex, Nearest) {
+    Coords::zoneIndex index(catalog);
+
+    const unsigned long ks[] = {1, 7, 100, size + 1};
+
+    std::vector<unsigned long> result;
+    for (unsigned long i = 0; i < centers.size(); ++i)
+      for (unsigned int k = 0; k < sizeof(ks)/sizeof(ks[0]); ++k) {
+	index.nearest(centers[i], ks[k], result);
+	EXPECT_EQ(scanNearest(catalog, centers[i], ks[k]), result)
+	  << "seed " << seed << " center " << i << " k " << ks[k];
+      }
+  }
+
+  TEST_F(RandomZoneIndex, Concurrent) {
+    const Coords::zoneIndex index(catalog);
+
+    std::vector< std::vector<unsigned long> > expected(centers.size());
+    for (unsigned long i = 0; i < centers.size(); ++i)
+      index.coneSearch(centers[i], Coords::angle(5), expected[i]);
+
+    const unsigned int n_threads(4);
+    std::vector<int> mismatches(n_threads, 0);
+    std::vector<std::thread> pool;
+
+    for (unsigned int t = 0; t < n_threads; ++t)
+      pool.push_back(std::thread([&, t]() {
+	    std::vector<unsigned long> result;
+	    for (unsigned long i = 0; i < centers.size(); ++i) {
+	      index.coneSearch(centers[i], Coords::angle(5), result);
+	      if (result != expected[i])
+		++mismatches[t];
+	    }
+	  }));
+
+    for (unsigned int t = 0; t < n_threads; ++t)
+      pool[t].join();
+
+    for (unsigned int t = 0; t < n_threads; ++t)
+      EXPECT_EQ(0, mismatches[t]) << "thread " << t;
+  }
+
+} // end anonymous namespace
+
+
+// ==================
+// ===== main() =====
+// ==================
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}